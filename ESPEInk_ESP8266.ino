@@ -16,17 +16,26 @@
 
 #include <WiFiManager.h>
 #include <ESP8266HTTPClient.h>
-#include <ESP8266httpUpdate.h>
+#include <Updater.h>
 #include <ESP8266WebServer.h>
 #include <ArduinoJson.h>
 #include <FS.h>
 #include <PubSubClient.h>
+#include <WiFiUdp.h>
 #include "ctx.h"
+#include "cpu.h"
+#include "trace.h"
+#include "log.h"
+#include "arena.h"
+#include "scheduler.h"
+#include "profile.h"
+#include "beacon.h"
+#include "wallclock.h"
+#include "power.h"
 
-#include "scripts.h"    // JavaScript code
-#include "css.h"        // Cascading Style Sheets
-#include "html.h"       // HTML page of the tool
 #include "epd.h"        // e-Paper driver
+#include "metrics.h"    // Prometheus metrics of the web server
+#include "html.h"       // web UI of the tool
 
 ESP8266WebServer server(80);
 IPAddress myIP;       // IP address in your local wifi net
@@ -38,21 +47,54 @@ PubSubClient mqttClient(espClient);
 const int FW_VERSION = 20; // for OTA
 // -----------------------------------------------------------------------------------------------------
 const char *CONFIG_FILE = "/config.json";
-const float TICKS_PER_SECOND = 80000000; // 80 MHz processor
 const int UPTIME_SEC = 10;
 const int MAX_CONNECTION_FAILURES = 1;
+const int MQTT_MAX_RETRIES = 5;          // connection attempts before going back to sleep
+const int MQTT_RETRY_DELAY_MS = 500;     // first retry delay, doubled on every further attempt
+const int MQTT_WAIT_MS = 1000;           // upper bound of waiting for the retained update status
+const int UPDATE_INSTALL_FAILED = -100; // updateFirmware(): not flashed or MD5 mismatch, HTTPClient errors are -1 to -11
+const int WIFI_CONNECT_TIMEOUT_MS = 10000; // association with the stored WiFi before WiFiManager takes over
+const int SERVER_QUIET_MS = 4000;        // without MQTT, sleep before UPTIME_SEC if no request came in for this long
+const int SERVER_POLL_MS = 20;           // idle time between two polls of the web server, spent in light sleep
+const int SERVER_LISTEN_INTERVAL = 1;    // DTIM periods the radio sleeps through in light sleep
+const int SLEEP_JITTER_PERCENT = 10;     // upper bound of the per device jitter, relative to the sleep time
+const int SLEEP_JITTER_MAX_SEC = 60;     // ... and in seconds
+const int SLEEP_MIN_SEC = 10;            // aligned wakes closer than this move to the next boundary
+const int SERVER_NEXT_PANEL_MS = 2000;   // with several panels, time for the upload of the next one after a refresh
 
 char accessPointName[24];
+char mqttMarkerTopic[32];
+char mqttTraceTopic[32];
+char mqttLogTopic[32];
+char mqttWakeTopic[32];
+unsigned long serverStartMillis = 0;
+unsigned long lastRequestMillis = 0;
+long nextWakeSec = 0; // next wake asked for by the server, 0 for the configured sleep time
 bool shouldSaveConfig = false;
 bool isUpdateAvailable = false;
 bool isDisplayUpdateRunning = false;
 bool isMqttEnabled = false;
+bool isMarkerReceived = false;
+bool isRefreshPending[EPD_PANELS];      // SHOW received, refresh not started yet
+uint8_t uploadingPanels = 0;            // bit per panel, from /EPD until its refresh is done
+uint8_t refreshingPanels = 0;           // bit per panel, refresh in progress
+bool isHandlingClient = false;
+static_assert(EPD_PANELS <= 8, "one bit per panel in uploadingPanels and refreshingPanels");
+bool isFrameShown = false;
 
 Ctx ctx;
 
 // -----------------------------------------------------------------------------------------------------
 void setup() {
+	// an intermediate wake of a chained sleep goes back to sleep right here
+	clockChain();
+	cpuBoost(false);
+	uint32_t setupStart = traceStart();
+	traceBegin();
+	beaconBegin();
 	String resetReason = ESP.getResetReason();
+	clockBegin(resetReason == "Deep-Sleep Wake");
+	powerBegin(resetReason == "Deep-Sleep Wake");
 	Serial.begin(115200);
 	Serial.println("\r\nESPEInk_ESP8266 v" + String(FW_VERSION) + ", reset reason='" + resetReason + "'...");
 	Serial.println("Entering setup...");
@@ -60,12 +102,37 @@ void setup() {
 //	pinMode(LED_BUILTIN, OUTPUT); // won't work, waveshare uses D2 as DC
 //	digitalWrite(LED_BUILTIN, HIGH);
 
+	uint32_t phaseStart = traceStart();
 	bool isConfigValid = getConfig();
+	traceEnd(TRACE_CONFIG, phaseStart);
 	initMqttClientName();
 	initAccessPointName();
 
+	// an empty cell is not spent on WiFi and a refresh
+	if (powerIsBatteryEmpty()) {
+		long sleepSeconds = getSleepSeconds();
+		Serial.printf("\r\nBattery empty, going to sleep for %ld seconds.\r\n\r\n", sleepSeconds);
+		traceEnd(TRACE_SETUP, setupStart);
+		traceCommit();
+		clockDeepSleep(sleepSeconds);
+		delay(100);
+	}
+
+	// initialize the last used e-Paper while the SDK associates with the stored WiFi in the background;
+	// with MQTT most wakes find no update and do not need the panel at all
+	bool isWifiStarted = startWifi();
+	if (isWifiStarted && !ctx.isMqttEnabled() && EPD_isAvailable(ctx.panelIndex)) {
+		Serial.printf(" Initializing EPD %s...\r\n", EPD_dispMass[ctx.panelIndex].title);
+		initializeSpi();
+		phaseStart = traceStart();
+		EPD_dispPrepare(ctx.panelIndex);
+		traceEnd(TRACE_INIT, phaseStart);
+	}
+
 	ctx.initWifiManagerParameters();
-	bool wifiSetup = setupWifi();
+	phaseStart = traceStart();
+	bool wifiSetup = setupWifi(isWifiStarted);
+	traceEnd(TRACE_WIFI, phaseStart);
 	if (wifiSetup) {
 //		// first check if there is a valid config file
 //		if (!shouldSaveConfig && !isConfigValid) {
@@ -87,8 +154,10 @@ void setup() {
 		Serial.printf("  MQTT Server: %s:%d, Client: %s\r\n", ctx.mqttServer, ctx.mqttPort, ctx.mqttClientName);
 		Serial.printf("  MQTT UpdateStatusTopic: %s\r\n", ctx.mqttUpdateStatusTopic);
 		Serial.printf("  MQTT CommandTopic: %s\r\n", ctx.mqttCommandTopic);
-		Serial.printf("  sleep time: %ld\r\n", ctx.sleepTime);
+		Serial.printf("  sleep time: %ld, maximum: %ld\r\n", ctx.sleepTime, ctx.sleepMax);
+		Serial.printf("  wake alignment: %ld+%ld\r\n", ctx.wakeAlign, ctx.wakeOffset);
 		Serial.printf("  firmware base URL: %s\r\n", ctx.firmwareUrl);
+		Serial.printf("  beacon collector: %s\r\n", ctx.beaconHost[0] ? ctx.beaconHost : "broadcast");
 	}
 	saveConfig();
 
@@ -104,17 +173,27 @@ void setup() {
 			delay(3000);
 		}
 
-		Serial.printf("\r\nFailed do connect to WIFI, going to sleep for %ld seconds.\r\n\r\n", ctx.sleepTime);
-		ESP.deepSleep(ctx.sleepTime * 1000000);
+		long sleepSeconds = getSleepSeconds();
+		Serial.printf("\r\nFailed do connect to WIFI, going to sleep for %ld seconds.\r\n\r\n", sleepSeconds);
+		releasePanels();
+		traceEnd(TRACE_SETUP, setupStart);
+		traceCommit();
+		clockDeepSleep(sleepSeconds);
 		delay(100);
 	}
 
 	if (resetReason != "Deep-Sleep Wake") {
+		phaseStart = traceStart();
 		getUpdate();
+		traceEnd(TRACE_UPDATE, phaseStart);
 	}
 	myIP = WiFi.localIP();
+	if (ctx.wakeAlign > 0) {
+		clockStartSntp();
+	}
 	setupMqtt();
 
+	traceEnd(TRACE_SETUP, setupStart);
 	Serial.println("Setup complete.");
 }
 
@@ -141,8 +220,13 @@ bool getConfig() {
 					strlcpy(ctx.mqttUpdateStatusTopic, jsonDocument["mqttUpdateStatusTopic"] | "", sizeof ctx.mqttUpdateStatusTopic);
 					strlcpy(ctx.mqttCommandTopic, jsonDocument["mqttCommandTopic"] | "", sizeof ctx.mqttCommandTopic);
 					ctx.sleepTime = jsonDocument["sleepTime"] | 0;
+					ctx.sleepMax = jsonDocument["sleepMax"] | 0;
+					ctx.wakeAlign = jsonDocument["wakeAlign"] | 0;
+					ctx.wakeOffset = jsonDocument["wakeOffset"] | 0;
 					strlcpy(ctx.firmwareUrl, jsonDocument["firmwareUrl"] | "", sizeof ctx.firmwareUrl);
+					strlcpy(ctx.beaconHost, jsonDocument["beaconHost"] | "", sizeof ctx.beaconHost);
 					ctx.connectionErrorCount = jsonDocument["connectionErrorCount"] | 0;
+					ctx.panelIndex = jsonDocument["panelIndex"] | -1;
 
 					Serial.println(" Config file read.");
 					configFile.close();
@@ -168,19 +252,36 @@ bool getConfig() {
 
 // -----------------------------------------------------------------------------------------------------
 void initAccessPointName() {
-	sprintf(accessPointName, "ESPEInk-AP-%s", getMAC().c_str());
+	sprintf(accessPointName, "ESPEInk-AP-%s", getMAC());
 }
 
 // -----------------------------------------------------------------------------------------------------
 void initMqttClientName() {
 	if (!strlen(ctx.mqttClientName)) {
-		sprintf(ctx.mqttClientName, "ESPEInk_%s", getMAC().c_str());
+		sprintf(ctx.mqttClientName, "ESPEInk_%s", getMAC());
 	}
 }
 
 // -----------------------------------------------------------------------------------------------------
-bool setupWifi() {
+// the 3.x core keeps WiFi off at boot, so association with the stored credentials is started here,
+// returns false if there are none
+bool startWifi() {
+	WiFi.mode(WIFI_STA);
+	if (WiFi.SSID().length() == 0) {
+		return false;
+	}
+	WiFi.begin();
+	return true;
+}
+
+// -----------------------------------------------------------------------------------------------------
+bool setupWifi(bool isWifiStarted) {
 	Serial.println(" Connecting to WiFi...");
+	// WiFiManager would restart the association startWifi() began, it is only needed if that fails
+	if (isWifiStarted && WiFi.waitForConnectResult(WIFI_CONNECT_TIMEOUT_MS) == WL_CONNECTED) {
+		Serial.printf("  Connected to WiFi, got IP address: %s\r\n", WiFi.localIP().toString().c_str());
+		return true;
+	}
 
 	WiFiManager wifiManager;
 	wifiManager.setDebugOutput(false);
@@ -208,7 +309,11 @@ void requestMqttParameters(WiFiManager *wifiManager) {
 	wifiManager->addParameter(ctx.customMqttUpdateStatusTopic);
 	wifiManager->addParameter(ctx.customMqttCommandTopic);
 	wifiManager->addParameter(ctx.customSleepTime);
+	wifiManager->addParameter(ctx.customSleepMax);
+	wifiManager->addParameter(ctx.customWakeAlign);
+	wifiManager->addParameter(ctx.customWakeOffset);
 	wifiManager->addParameter(ctx.customFirmwareUrl);
+	wifiManager->addParameter(ctx.customBeaconHost);
 	wifiManager->setSaveConfigCallback(saveConfigCallback);
 }
 
@@ -220,10 +325,9 @@ void saveConfig() {
 //			Serial.println(" SPIFFS formated.");
 //		}
 		
-		Serial.println(" Saving config...");
 		File configFile = SPIFFS.open(CONFIG_FILE, "w");
 		if (!configFile) {
-			Serial.println("  Failed to open config file for writing.");
+			LOG_E("Failed to open config file for writing");
 		}
 		DynamicJsonDocument jsonDocument(1024);
 		jsonDocument["mqttServer"] = ctx.mqttServer;
@@ -234,16 +338,18 @@ void saveConfig() {
 		jsonDocument["mqttUpdateStatusTopic"] = ctx.mqttUpdateStatusTopic;
 		jsonDocument["mqttCommandTopic"] = ctx.mqttCommandTopic;
 		jsonDocument["sleepTime"] = ctx.sleepTime;
+		jsonDocument["sleepMax"] = ctx.sleepMax;
+		jsonDocument["wakeAlign"] = ctx.wakeAlign;
+		jsonDocument["wakeOffset"] = ctx.wakeOffset;
 		jsonDocument["firmwareUrl"] = ctx.firmwareUrl;
+		jsonDocument["beaconHost"] = ctx.beaconHost;
 		jsonDocument["connectionErrorCount"] = ctx.connectionErrorCount;
+		jsonDocument["panelIndex"] = ctx.panelIndex;
 		if (serializeJson(jsonDocument, configFile) == 0) {
-			Serial.println("  Failed to write to file.");
+			LOG_E("Failed to write config file");
 		}
 		configFile.close();
-		Serial.println(" Config saved.");
-		
-		serializeJson(jsonDocument, Serial);
-		Serial.println();
+		LOG_I("Config saved, panel %d", ctx.panelIndex);
 	}
 }
 
@@ -253,14 +359,59 @@ void saveConfigCallback() {
 }
 
 // -----------------------------------------------------------------------------------------------------
-String getMAC() {
-	uint8_t mac[6];
-	WiFi.macAddress(mac);
+const char *getMAC() {
+	static char result[13];
+	if (result[0] == '\0') {
+		uint8_t mac[6];
+		WiFi.macAddress(mac);
+		snprintf(result, sizeof(result), "%02x%02x%02x%02x%02x%02x", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+	}
+	return result;
+}
 
-	char result[14];
-	snprintf(result, sizeof(result), "%02x%02x%02x%02x%02x%02x", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+// -----------------------------------------------------------------------------------------------------
+// writes the image to flash and restarts, otherwise returns the HTTP response code of the image, or
+// UPDATE_INSTALL_FAILED if it was downloaded but could not be written or failed the MD5 check;
+// the MD5 of the image is taken from '<image>.md5' (md5sum output) if the server has it
+int updateFirmware(const char *imageUrl) {
+	char md5[33] = "";
+	HTTPClient httpClient;
+	httpClient.begin(espClient, arenaPrintf("%s.md5", imageUrl));
+	if (httpClient.GET() == 200) {
+		strlcpy(md5, httpClient.getString().c_str(), sizeof md5);
+	}
+	httpClient.end();
 
-	return String(result);
+	httpClient.begin(espClient, imageUrl);
+	int httpCode = httpClient.GET();
+	if (httpCode != 200) {
+		httpClient.end();
+		return httpCode;
+	}
+	int size = httpClient.getSize();
+	Serial.printf("  Downloading '%s', %d bytes\r\n", imageUrl, size);
+	// like ESPhttpUpdate, no UDP traffic while the flash is written
+	WiFiUDP::stopAll();
+	if (size <= 0 || !Update.begin(size)) {
+		httpClient.end();
+		return UPDATE_INSTALL_FAILED;
+	}
+	if (strlen(md5) == 32) {
+		Update.setMD5(md5);
+	} else {
+		Serial.println("  No MD5 file, the image is not verified");
+	}
+	// Update.end() checks the MD5 of the bytes as downloaded, i.e. of the gzip file for a gzip image
+	unsigned long writeStart = millis();
+	if (Update.writeStream(*httpClient.getStreamPtr()) != (size_t) size || !Update.end()) {
+		httpClient.end();
+		return UPDATE_INSTALL_FAILED;
+	}
+	httpClient.end();
+	Serial.printf("  Updated in %lu ms, restarting...\r\n", millis() - writeStart);
+	ESP.restart();
+	delay(100);
+	return 200;
 }
 
 // -----------------------------------------------------------------------------------------------------
@@ -269,13 +420,10 @@ void getUpdate() {
 		return;
 	}
 
-	String mac = getMAC();
-	String firmwareUrl = String(ctx.firmwareUrl);
-	firmwareUrl.concat(mac);
-	String firmwareVersionUrl = firmwareUrl;
-	firmwareVersionUrl.concat(".version");
+	ArenaScope scope;
+	const char *firmwareVersionUrl = arenaPrintf("%s%s.version", ctx.firmwareUrl, getMAC());
 
-	Serial.printf(" Checking for firmware update, version file '%s'...\r\n", firmwareVersionUrl.c_str());
+	Serial.printf(" Checking for firmware update, version file '%s'...\r\n", firmwareVersionUrl);
 	HTTPClient httpClient;
 	httpClient.begin(espClient, firmwareVersionUrl);
 	int httpCode = httpClient.GET();
@@ -285,22 +433,20 @@ void getUpdate() {
 		int newVersion = newFWVersion.toInt();
 		if (newVersion > FW_VERSION) {
 			Serial.println("  Updating...");
-			String firmwareImageUrl = firmwareUrl;
-			firmwareImageUrl.concat(".bin");
-			t_httpUpdate_return ret = ESPhttpUpdate.update(espClient, firmwareImageUrl);
-
-			switch (ret) {
-				case HTTP_UPDATE_FAILED:
-					Serial.printf("  Update failed: (%d): %s\r\n", ESPhttpUpdate.getLastError(), ESPhttpUpdate.getLastErrorString().c_str());
-					break;
-
-				case HTTP_UPDATE_NO_UPDATES:
-					Serial.printf("  Update file '%s' found\r\n", firmwareImageUrl.c_str());
-					break;
-
-				case HTTP_UPDATE_OK:
-					Serial.printf("  Updated\r\n");
-					break;
+			// the gzip image is preferred, the bootloader inflates it while installing it
+			const char *firmwareImageUrl = arenaPrintf("%s%s.bin.gz", ctx.firmwareUrl, getMAC());
+			int imageCode = updateFirmware(firmwareImageUrl);
+			if (imageCode == 404) {
+				firmwareImageUrl = arenaPrintf("%s%s.bin", ctx.firmwareUrl, getMAC());
+				imageCode = updateFirmware(firmwareImageUrl);
+			}
+			if (imageCode == 404) {
+				Serial.printf("  Update file '%s' not found\r\n", firmwareImageUrl);
+			} else if (imageCode == UPDATE_INSTALL_FAILED) {
+				// an empty error string: the server sent no content length
+				Serial.printf("  Update of '%s' not installed: %s\r\n", firmwareImageUrl, Update.getErrorString().c_str());
+			} else {
+				Serial.printf("  Update failed, got HTTP response code %d.\r\n", imageCode);
 			}
 
 		} else if (newVersion == -1) {
@@ -321,59 +467,121 @@ void getUpdate() {
 
 // -----------------------------------------------------------------------------------------------------
 void initializeSpi() {
-	pinMode(CS_PIN, OUTPUT);
-	pinMode(RST_PIN, OUTPUT);
+	for (int panel = 0; panel < EPD_PANELS; ++panel) {
+		pinMode(EPD_pins[panel].cs, OUTPUT);
+		digitalWrite(EPD_pins[panel].cs, HIGH);
+		if (EPD_pins[panel].rst != EPD_NO_PIN) {
+			pinMode(EPD_pins[panel].rst, OUTPUT);
+		}
+		pinMode(EPD_pins[panel].busy, INPUT);
+	}
 	pinMode(DC_PIN, OUTPUT);
-	pinMode(BUSY_PIN, INPUT);
 	SPI.begin();
 }
 
+// -----------------------------------------------------------------------------------------------------
+void releasePanels() {
+	for (int panel = 0; panel < EPD_PANELS; ++panel) {
+		EPD_PanelScope scope(panel);
+		EPD_dispRelease();
+	}
+}
+
 // -----------------------------------------------------------------------------------------------------
 void setupMqtt() {
+	snprintf(mqttMarkerTopic, sizeof mqttMarkerTopic, "%s/marker", ctx.mqttClientName);
+	snprintf(mqttTraceTopic, sizeof mqttTraceTopic, "%s/trace", ctx.mqttClientName);
+	snprintf(mqttLogTopic, sizeof mqttLogTopic, "%s/log", ctx.mqttClientName);
+	snprintf(mqttWakeTopic, sizeof mqttWakeTopic, "%s/wake", ctx.mqttClientName);
 	mqttClient.setServer(ctx.mqttServer, ctx.mqttPort);
 	mqttClient.setCallback(callback);
 }
 
 // -----------------------------------------------------------------------------------------------------
 void initializeWebServer() {
+	// the UI assets are answered with 304 if the browser has them cached
+	const char *headerKeys[] = { "If-None-Match" };
+	server.collectHeaders(headerKeys, 1);
+	// every request postpones the quiet timeout
+	server.addHook([](const String&, const String&, WiFiClient*, ESP8266WebServer::ContentTypeFunction) {
+		lastRequestMillis = millis();
+		return ESP8266WebServer::CLIENT_REQUEST_CAN_CONTINUE;
+	});
 	server.on("/", handleBrowserCall);
 	server.on("/styles.css", sendCSS);
-	server.on("/processingA.js", sendJS_A);
-	server.on("/processingB.js", sendJS_B);
-	server.on("/processingC.js", sendJS_C);
-	server.on("/processingD.js", sendJS_D);
-	server.on("/LOAD", EPD_Load);
-	server.on("/EPD", EPD_Init);
-	server.on("/NEXT", EPD_Next);
-	server.on("/SHOW", EPD_Show);
+	server.on("/app.js", sendJS);
+	server.on("/config.js", sendConfigJS);
+	// the first panel answers at /EPD etc., every panel at /<panel>/EPD etc.
+	server.on("/LOAD", []() { EPD_Load(0); });
+	server.on("/EPD", []() { EPD_Init(0); });
+	server.on("/NEXT", []() { EPD_Next(0); });
+	server.on("/SHOW", []() { EPD_Show(0); });
+	for (int panel = 0; panel < EPD_PANELS; ++panel) {
+		String prefix = "/" + String(panel);
+		server.on(prefix + "/LOAD", [panel]() { EPD_Load(panel); });
+		server.on(prefix + "/EPD", [panel]() { EPD_Init(panel); });
+		server.on(prefix + "/NEXT", [panel]() { EPD_Next(panel); });
+		server.on(prefix + "/SHOW", [panel]() { EPD_Show(panel); });
+	}
 	server.on("/reset", factoryReset);
 	server.on("/abort", abortDisplayUpdate);
+	server.on("/WAKE", setNextWake);
+	server.on("/metrics", sendMetrics);
+	server.on("/log", sendLog);
+#if PROFILE_ZONES
+	server.on("/profile", sendProfile);
+#endif
 	server.onNotFound(handleNotFound);
 }
 
 // -----------------------------------------------------------------------------------------------------
 void loop() {
+	schedulerRun(false);
+	// between polls the radio can doze in light sleep, uploads run at full speed
+	if (!isDisplayUpdateRunning) {
+		delay(SERVER_POLL_MS);
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+// tasks of the cooperative scheduler, see scheduler.h
+// -----------------------------------------------------------------------------------------------------
+void taskMqtt() {
 	if (!isDisplayUpdateRunning && isMqttEnabled && !mqttClient.connected()) {
-		reconnect();
-		Serial.println(" Reconnected, waiting for incoming MQTT messages...");
-		for (int i = 0; i < 100; ++i) {
-			mqttClient.loop();
-			delay(10);
+		uint32_t mqttStart = traceStart();
+		bool isConnected = reconnect();
+		traceEnd(TRACE_MQTT, mqttStart);
+		if (isConnected) {
+			tracePublish(mqttClient, mqttTraceTopic);
+			Serial.println(" Reconnected, waiting for incoming MQTT messages...");
+			// the retained update status is delivered before our own marker comes back
+			isMarkerReceived = false;
+			mqttClient.publish(mqttMarkerTopic, "");
+			unsigned long waitStart = millis();
+			while (!isUpdateAvailable && !isMarkerReceived && millis() - waitStart < MQTT_WAIT_MS) {
+				{
+					PROFILE_ZONE(PROFILE_MQTT);
+					mqttClient.loop();
+				}
+				delay(1);
+			}
 		}
 		if (!isUpdateAvailable) {
 			Serial.println(" No update available.");
 		}
 	}
+}
 
-	static unsigned long startCycle = ESP.getCycleCount();
-	unsigned long currentCycle = ESP.getCycleCount();
-	unsigned long difference;
-	if (currentCycle < startCycle) {
-		difference = (4294967295 - startCycle + currentCycle);
-	} else {
-		difference = (currentCycle - startCycle);
+// -----------------------------------------------------------------------------------------------------
+void taskMqttLoop() {
+	if (isMqttEnabled && mqttClient.connected()) {
+		PROFILE_ZONE(PROFILE_MQTT);
+		mqttClient.loop();
 	}
+}
 
+// -----------------------------------------------------------------------------------------------------
+void taskServer() {
 	if ((isMqttEnabled && isUpdateAvailable)
 			|| (isMqttEnabled && isDisplayUpdateRunning)
 			|| !isMqttEnabled) {
@@ -382,55 +590,166 @@ void loop() {
 			initializeWebServer();
 			server.begin();
 			serverStarted = true;
+			serverStartMillis = millis();
+			lastRequestMillis = serverStartMillis;
+			WiFi.setSleepMode(WIFI_LIGHT_SLEEP, SERVER_LISTEN_INTERVAL);
 
 			if (isUpdateAvailable) {
 				mqttClient.publish(ctx.mqttCommandTopic, "true");
 				delay(100);
 			}
+			beaconSend(ctx.beaconHost, getMAC(), ctx.panelIndex, FW_VERSION);
 			Serial.printf("Webserver started, waiting %sfor data\r\n", isMqttEnabled ? "" : "10s ");
 
 		} else {
+			PROFILE_ZONE(PROFILE_HTTP);
+			isHandlingClient = true;
 			server.handleClient();
+			isHandlingClient = false;
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+// serves requests while a panel refreshes, so the next panel loads meanwhile
+void taskServerBusy() {
+	if (refreshingPanels && serverStartMillis && !isHandlingClient) {
+		PROFILE_ZONE(PROFILE_HTTP);
+		isHandlingClient = true;
+		server.handleClient();
+		isHandlingClient = false;
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void taskBeacon() {
+	beaconPoll();
+	if (beaconNextWake > 0) {
+		nextWakeSec = beaconNextWake;
+		beaconNextWake = 0;
+	}
+}
 
-			int decile = fmod(difference / (TICKS_PER_SECOND / 100.0), 100.0);
-			static bool ledStatus = false;
-			if (!ledStatus && decile == 95) {
-//				digitalWrite(LED_BUILTIN, LOW);
-				ledStatus = true;
-			} else if (ledStatus && decile == 0) {
-//				digitalWrite(LED_BUILTIN, HIGH);
-				ledStatus = false;
+// -----------------------------------------------------------------------------------------------------
+// runs in the background as well, but starts no refresh while another one is running: the show
+// functions wait for their panel, a nested refresh would hold up the sleep command of the outer one
+// until it is done itself. So the next panel loads during a refresh and refreshes after it
+void taskRefresh() {
+	for (int panel = 0; panel < EPD_PANELS; ++panel) {
+		uint8_t bit = 1 << panel;
+		if (isRefreshPending[panel] && !refreshingPanels) {
+			isRefreshPending[panel] = false;
+			refreshingPanels |= bit;
+			// the refresh mostly waits for the panel, unless it runs within the busy wait of an upload
+			if (!(uploadingPanels & ~refreshingPanels)) {
+				cpuBoost(false);
+			}
+			{
+				EPD_PanelScope scope(panel);
+				// Show results and Sleep
+				uint32_t showStart = traceStart();
+				EPD_dispMass[EPD_dispIndex].show();
+				traceEnd(TRACE_SHOW, showStart);
+				metricsBusy();
+			}
+			beaconFrameShown();
+			refreshingPanels &= ~bit;
+			uploadingPanels &= ~bit;
+			isFrameShown = true;
+			if (!refreshingPanels && !uploadingPanels) {
+				isDisplayUpdateRunning = false;
+				// an upload that came in during the refresh may have left the boost on
+				cpuBoost(false);
+				WiFi.setSleepMode(WIFI_LIGHT_SLEEP, SERVER_LISTEN_INTERVAL);
 			}
 		}
 	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void taskClock() {
+	clockPoll();
+}
+
+// -----------------------------------------------------------------------------------------------------
+void taskLed() {
+	static unsigned long blinkStart = millis();
+	int decile = (millis() - blinkStart) / 10 % 100;
+	static bool ledStatus = false;
+	if (!ledStatus && decile >= 95) {
+//		digitalWrite(LED_BUILTIN, LOW);
+		ledStatus = true;
+	} else if (ledStatus && decile < 95) {
+//		digitalWrite(LED_BUILTIN, HIGH);
+		ledStatus = false;
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void taskSleep() {
+	static unsigned long windowStart = millis();
 
 	bool isTimeToSleep = false;
 	if (isMqttEnabled && !isUpdateAvailable) {
 		isTimeToSleep = true;
 
-	} else if (difference > UPTIME_SEC * TICKS_PER_SECOND) {
+	} else if (millis() - windowStart > UPTIME_SEC * 1000UL
+			|| (!isMqttEnabled && serverStartMillis && millis() - lastRequestMillis > SERVER_QUIET_MS)) {
+		// with MQTT the home automation starts the upload after the update status, it gets the whole window
+		isTimeToSleep = true;
+
+	} else if ((isFrameShown && (EPD_PANELS == 1 || millis() - lastRequestMillis > SERVER_NEXT_PANEL_MS))
+			|| isBeaconNoWork) {
+		// the work of this wake is done
 		isTimeToSleep = true;
 	}
 
 	if (!isDisplayUpdateRunning) {
 		if (isTimeToSleep) {
 			if (ctx.sleepTime > 0) {
+				logPublish(mqttClient, mqttLogTopic);
 				disconnect();
-				Serial.printf("\r\nGoing to sleep for %ld seconds.\r\n\r\n", ctx.sleepTime);
-				ESP.deepSleep(ctx.sleepTime * 1000000);
+				releasePanels();
+				if (serverStartMillis) {
+					traceAdd(TRACE_SERVER, (millis() - serverStartMillis) * 1000);
+				}
+				long sleepSeconds = getSleepSeconds();
+				traceCommit();
+#if PROFILE_ZONES
+				profilePrint(Serial);
+#endif
+				Serial.printf("\r\nGoing to sleep for %ld seconds.\r\n\r\n", sleepSeconds);
+				clockDeepSleep(sleepSeconds);
 				delay(100);
 
 			} else { // avoid overheating
-				startCycle = ESP.getCycleCount();
+				windowStart = millis();
+				lastRequestMillis = windowStart;
+				isFrameShown = false;
+				isBeaconNoWork = false;
 				delay(1000);
 			}
 		}
 	}
 }
 
+SchedulerTask schedulerTasks[] = {
+	// run, interval, isBackground
+	{ taskMqtt, 0, false },
+	{ taskMqttLoop, 100, true },
+	{ taskServer, 0, false },
+	{ taskServerBusy, 0, true },
+	{ taskBeacon, 50, false },
+	{ taskRefresh, 0, true },
+	{ taskLed, 50, false },
+	{ taskClock, 100, false },
+	{ taskSleep, 0, false }
+};
+const int SCHEDULER_TASKS = sizeof schedulerTasks / sizeof schedulerTasks[0];
+
 // -----------------------------------------------------------------------------------------------------
 void factoryReset() {
-	server.send(200, "text/plain", "Resetting WLAN settings...\r\r\n");
+	server.send_P(200, PSTR("text/plain"), PSTR("Resetting WLAN settings...\r\r\n"));
 	delay(200);
 
 	WiFiManager wifiManager;
@@ -441,18 +760,84 @@ void factoryReset() {
 // -----------------------------------------------------------------------------------------------------
 void abortDisplayUpdate() {
 	isDisplayUpdateRunning = false;
+	uploadingPanels = 0;
+	cpuBoost(false);
+}
+
+// -----------------------------------------------------------------------------------------------------
+void setNextWake() {
+	nextWakeSec = server.arg("in").toInt();
+	LOG_I("Next wake in %ld s", nextWakeSec);
+	server.send_P(200, PSTR("text/plain"), PSTR("Wake ok\r\n"));
+}
+
+// -----------------------------------------------------------------------------------------------------
+// The configured sleep time, or the time to the next multiple of wakeAlign plus wakeOffset if the
+// wall clock is known, plus a jitter derived from the MAC, so displays with the same sleep time
+// drift apart after a power cut. With sleepMax the number of periods backs off while there are
+// no updates, and a low battery stretches it further. A wake time asked for by the server
+// replaces all of them. Called once per wake, the decision goes into the trace.
+long getSleepSeconds() {
+	traceCurrent.batteryMv = powerBatteryMv;
+	if (nextWakeSec > 0) {
+		traceCurrent.sleepReason = SLEEP_SERVER;
+		traceCurrent.sleepSeconds = nextWakeSec;
+		return nextWakeSec;
+	}
+	SleepReason reason = SLEEP_FIXED;
+	long periods = 1;
+	if (ctx.sleepTime > 0 && ctx.sleepMax > ctx.sleepTime) {
+		periods = powerBackoff(isFrameShown, ctx.sleepMax / ctx.sleepTime);
+		reason = isFrameShown ? SLEEP_UPDATED : SLEEP_BACKOFF;
+	}
+	int stretch = powerBatteryStretch();
+	if (stretch > 1) {
+		periods *= stretch;
+		reason = SLEEP_BATTERY;
+	}
+	long sleepSeconds = ctx.sleepTime * periods;
+	uint64_t nowMs;
+	clockPoll();
+	if (ctx.wakeAlign > 0 && clockNow(nowMs)) {
+		long now = (long) ((nowMs / 1000) % ctx.wakeAlign);
+		sleepSeconds = (ctx.wakeOffset - now + 2 * ctx.wakeAlign) % ctx.wakeAlign;
+		if (sleepSeconds < SLEEP_MIN_SEC) {
+			sleepSeconds += ctx.wakeAlign;
+		}
+		sleepSeconds += (periods - 1) * ctx.wakeAlign;
+	}
+	long jitterRange = sleepSeconds * SLEEP_JITTER_PERCENT / 100;
+	if (jitterRange > SLEEP_JITTER_MAX_SEC) {
+		jitterRange = SLEEP_JITTER_MAX_SEC;
+	}
+	uint32_t hash = 2166136261u;
+	for (const char *mac = getMAC(); *mac; ++mac) {
+		hash = (hash ^ (uint8_t) *mac) * 16777619u;
+	}
+	sleepSeconds += (long) (hash % (jitterRange + 1));
+	traceCurrent.sleepReason = reason;
+	traceCurrent.sleepSeconds = sleepSeconds;
+	return sleepSeconds;
 }
 
 // -----------------------------------------------------------------------------------------------------
 void callback(char* topic, byte* message, unsigned int length) {
-	String messageTemp;
+	if (strcmp(topic, mqttMarkerTopic) == 0) {
+		isMarkerReceived = true;
+		return;
+	}
+
+	ArenaScope scope;
+	const char *messageTemp = arenaCopy((const char*) message, length);
 
-	for (int i = 0; i < length; i++) {
-		messageTemp += (char) message[i];
+	if (strcmp(topic, mqttWakeTopic) == 0) {
+		nextWakeSec = atol(messageTemp);
+		LOG_I("Next wake in %ld s", nextWakeSec);
+		return;
 	}
 
-	if (String(topic) == ctx.mqttUpdateStatusTopic
-			&& messageTemp == "true") {
+	if (strcmp(topic, ctx.mqttUpdateStatusTopic) == 0
+			&& strcmp(messageTemp, "true") == 0) {
 		isUpdateAvailable = true;
 	}
 
@@ -461,13 +846,19 @@ void callback(char* topic, byte* message, unsigned int length) {
 }
 
 // -----------------------------------------------------------------------------------------------------
-void reconnect() {
+bool reconnect() {
 	Serial.printf("Connecting to MQTT: %s:%d...\r\n", ctx.mqttServer, ctx.mqttPort);
-	while (!mqttClient.connected()) {
+	int retryDelay = MQTT_RETRY_DELAY_MS;
+	for (int attempt = 1; !mqttClient.connected(); ++attempt) {
 		// clientID, username, password, willTopic, willQoS, willRetain, willMessage, cleanSession
 		if (!mqttClient.connect(ctx.mqttClientName, ctx.mqttUser, ctx.mqttPassword, NULL, 0, 0, NULL, 0)) {
-			Serial.println(" Connecting failed, try reconnect in 5s.");
-			delay(5000);
+			if (attempt >= MQTT_MAX_RETRIES) {
+				Serial.printf(" Connecting failed %d times, giving up.\r\n", attempt);
+				return false;
+			}
+			Serial.printf(" Connecting failed, try reconnect in %dms.\r\n", retryDelay);
+			delay(retryDelay);
+			retryDelay *= 2;
 		} else {
 			Serial.println(" Connected.");
 			boolean rc = mqttClient.subscribe(ctx.mqttUpdateStatusTopic, 1);
@@ -476,8 +867,11 @@ void reconnect() {
 			} else {
 				Serial.printf(" Subscription to %s failed: %d\r\n", ctx.mqttUpdateStatusTopic, rc);
 			}
+			mqttClient.subscribe(mqttMarkerTopic);
+			mqttClient.subscribe(mqttWakeTopic);
 		}
 	}
+	return true;
 }
 
 // -----------------------------------------------------------------------------------------------------
@@ -498,41 +892,107 @@ void handleBrowserCall() {
 // -----------------------------------------------------------------------------------------------------
 // waveshare display part
 // -----------------------------------------------------------------------------------------------------
-void EPD_Init() {
+void EPD_Init(int panel) {
+	unsigned long requestStart = millis();
+	EPD_PanelScope scope(panel);
+	int index = ((int) server.arg(0)[0] - 'a')
+			+ (((int) server.arg(0)[1] - 'a') << 4);
+	if (!EPD_isAvailable(index)) {
+		// unknown type, or left out of this build by EPD_PANEL
+		server.send_P(400, PSTR("text/plain"), PSTR("Init failed, EPD not available\r\n"));
+		metricsRequest(METRICS_EPD, requestStart);
+		return;
+	}
 	isDisplayUpdateRunning = true;
+	uploadingPanels |= 1 << panel;
+	// no light sleep during the upload, it would add a DTIM period to every request
+	WiFi.setSleepMode(WIFI_NONE_SLEEP);
+	cpuBoost(true);
 	isUpdateAvailable = false;
+	// the frame hash covers all panels in upload order
+	if (panel == 0) {
+		beaconFrameStart();
+	}
+	beaconFrameData(server.arg(0).c_str(), server.arg(0).length());
 	initializeSpi();
-	EPD_dispIndex = ((int) server.arg(0)[0] - 'a')
-			+ (((int) server.arg(0)[1] - 'a') << 4);
+	// the e-Paper prepared in setup() is only of use if the type matches
+	if (index != EPD_dispIndex) {
+		EPD_dispReady = false;
+	}
+	EPD_dispIndex = index;
+	// optional third character '2': client sends black and red channel as one 2-bit stream
+	EPD_dispPlanes = server.arg(0).length() > 2 && server.arg(0)[2] == '2'
+			&& EPD_isPlanesCapable(EPD_dispIndex);
 	// Print log message: initialization of e-Paper (e-Paper's type)
-	Serial.printf("EPD %s\r\n", EPD_dispMass[EPD_dispIndex].title);
+	LOG_I("EPD %d: %s", panel, EPD_dispMass[EPD_dispIndex].title);
 
 	// Initialization
-	EPD_dispInit();
-	server.send(200, "text/plain", "Init ok\r\n");
+	uint32_t initStart = traceStart();
+	int initResult = EPD_dispInit();
+	traceEnd(TRACE_INIT, initStart);
+	if (initResult != 0) {
+		// the controller never got idle, the upload of this panel cannot go on
+		uploadingPanels &= ~(1 << panel);
+		if (!refreshingPanels && !uploadingPanels) {
+			isDisplayUpdateRunning = false;
+		}
+		server.send_P(500, PSTR("text/plain"), PSTR("Init failed, EPD busy\r\n"));
+		metricsRequest(METRICS_EPD, requestStart);
+		return;
+	}
+
+	// remember the type of the first panel, so the next wake up can initialize it during setup
+	if (panel == 0 && ctx.panelIndex != EPD_dispIndex) {
+		ctx.panelIndex = EPD_dispIndex;
+		shouldSaveConfig = true;
+		saveConfig();
+		shouldSaveConfig = false;
+	}
+	server.send_P(200, PSTR("text/plain"), EPD_dispPlanes ? PSTR("Init ok, planes\r\n") : PSTR("Init ok\r\n"));
+	metricsRequest(METRICS_EPD, requestStart);
 }
 
-void EPD_Load() {
+void EPD_Load(int panel) {
+	unsigned long requestStart = millis();
+	EPD_PanelScope scope(panel);
 	//server.arg(0) = data+data.length+'LOAD'
-	String p = server.arg(0);
+	const String &p = server.arg(0);
+	bool isLoaded = false;
 	if (p.endsWith("LOAD")) {
 		int index = p.length() - 8;
 		int L = ((int) p[index] - 'a') + (((int) p[index + 1] - 'a') << 4)
 				+ (((int) p[index + 2] - 'a') << 8)
 				+ (((int) p[index + 3] - 'a') << 12);
 		if (L == (p.length() - 8)) {
-			Serial.println("LOAD");
+			LOG_D("LOAD %d", L);
+			beaconFrameData(p.c_str(), L);
 			// if there is loading function for current channel (black or red)
 			// Load data into the e-Paper
-			if (EPD_dispLoad != 0)
+			if (EPD_dispLoad != 0) {
+				uint32_t loadStart = traceStart();
+				uint64_t loadSpiStart = EPD_spiCycles;
 				EPD_dispLoad();
+				traceEnd(TRACE_LOAD, loadStart);
+				metricsLoad(L, loadStart, loadSpiStart);
+				traceCurrent.loads++;
+			}
+			isLoaded = true;
 		}
 	}
-	server.send(200, "text/plain", "Load ok\r\n");
+	if (isLoaded) {
+		server.send_P(200, PSTR("text/plain"), PSTR("Load ok\r\n"));
+	} else {
+		// truncated request, the client sends the same data again
+		metricsLoadRejected++;
+		server.send_P(400, PSTR("text/plain"), PSTR("Load failed\r\n"));
+	}
+	metricsRequest(METRICS_LOAD, requestStart);
 }
 
-void EPD_Next() {
-	Serial.println("NEXT");
+void EPD_Next(int panel) {
+	unsigned long requestStart = millis();
+	EPD_PanelScope scope(panel);
+	LOG_I("NEXT");
 
 	// Instruction code for for writting data into
 	// e-Paper's memory
@@ -547,31 +1007,47 @@ void EPD_Next() {
 	// Setup the function for loading choosen channel's data
 	EPD_dispLoad = EPD_dispMass[EPD_dispIndex].chRd;
 
-	server.send(200, "text/plain", "Next ok\r\n");
+	server.send_P(200, PSTR("text/plain"), PSTR("Next ok\r\n"));
+	metricsRequest(METRICS_NEXT, requestStart);
 }
 
-void EPD_Show() {
-	Serial.println("\r\nSHOW\r\n");
-	// Show results and Sleep
-	EPD_dispMass[EPD_dispIndex].show();
-	server.send(200, "text/plain", "Show ok\r\n");
-	delay(200);
-	isDisplayUpdateRunning = false;
+void EPD_Show(int panel) {
+	unsigned long requestStart = millis();
+	EPD_PanelScope scope(panel);
+	LOG_I("SHOW");
+	// Write the spooled red channel of a combined upload
+	if (EPD_dispPlanes) {
+		EPD_loadSpooled();
+	}
+	// The refresh is done by taskRefresh() after the response went out
+	isRefreshPending[panel] = true;
+	server.send_P(200, PSTR("text/plain"), PSTR("Show ok\r\n"));
+	metricsRequest(METRICS_SHOW, requestStart);
+}
+
+void sendLog() {
+	ResponsePrint response(200, "text/plain");
+	logPrint(response);
+}
+
+#if PROFILE_ZONES
+void sendProfile() {
+	ResponsePrint response(200, "text/plain");
+	profilePrint(response);
 }
+#endif
 
 void handleNotFound() {
-	String message = "File Not Found\n\n";
-	message += "URI: ";
-	message += server.uri();
-	message += "\nMethod: ";
-	message += (server.method() == HTTP_GET) ? "GET" : "POST";
-	message += "\nArguments: ";
-	message += server.args();
-	message += "\n";
+	ResponsePrint response(200, "text/plain");
+	response.printf("File Not Found\n\nURI: %s\nMethod: %s\nArguments: %d\n", server.uri().c_str(),
+			(server.method() == HTTP_GET) ? "GET" : "POST", server.args());
 	for (uint8_t i = 0; i < server.args(); i++) {
-		message += " " + server.argName(i) + ": " + server.arg(i) + "\n";
+		response.print(' ');
+		response.print(server.argName(i));
+		response.print(": ");
+		response.print(server.arg(i));
+		response.print('\n');
 	}
-	server.send(200, "text/plain", message);
 	Serial.print("Unknown URI: ");
 	Serial.println(server.uri());
 }
@@ -0,0 +1,80 @@
+/**
+ * Bump-pointer arena for the temporary strings of web and MQTT handlers.
+ *
+ * arenaAlloc() hands out memory of a static buffer and an ArenaScope at the
+ * top of a handler gives it back when the handler returns, so handlers do not
+ * allocate on the heap and cannot fragment it in long running sessions.
+ * arenaCopy() and arenaPrintf() never fail, they truncate to the remaining
+ * capacity instead.
+ */
+
+const size_t ARENA_SIZE = 1024;
+
+uint8_t arenaBuffer[ARENA_SIZE] __attribute__((aligned(4)));
+size_t arenaUsed;       // bytes in use
+size_t arenaPeak;       // highest arenaUsed since start
+uint32_t arenaTruncated; // strings that did not fit
+
+// -----------------------------------------------------------------------------------------------------
+void *arenaAlloc(size_t size) {
+	size = (size + 3) & ~3;
+	if (size > ARENA_SIZE - arenaUsed) {
+		return nullptr;
+	}
+	void *memory = arenaBuffer + arenaUsed;
+	arenaUsed += size;
+	if (arenaUsed > arenaPeak) {
+		arenaPeak = arenaUsed;
+	}
+	return memory;
+}
+
+// -----------------------------------------------------------------------------------------------------
+char *arenaCopy(const char *data, size_t length) {
+	size_t capacity = ARENA_SIZE - arenaUsed;
+	if (length + 1 > capacity) {
+		length = capacity > 0 ? capacity - 1 : 0;
+		arenaTruncated++;
+	}
+	char *text = (char*) arenaAlloc(length + 1);
+	if (text == nullptr) {
+		return (char*) "";
+	}
+	memcpy(text, data, length);
+	text[length] = '\0';
+	return text;
+}
+
+// -----------------------------------------------------------------------------------------------------
+char *arenaPrintf(const char *format, ...) {
+	size_t capacity = ARENA_SIZE - arenaUsed;
+	if (capacity == 0) {
+		arenaTruncated++;
+		return (char*) "";
+	}
+	char *text = (char*) arenaBuffer + arenaUsed;
+	va_list args;
+	va_start(args, format);
+	size_t length = vsnprintf(text, capacity, format, args);
+	va_end(args);
+	if (length + 1 > capacity) {
+		length = capacity - 1;
+		arenaTruncated++;
+	}
+	arenaAlloc(length + 1);
+	return text;
+}
+
+// -----------------------------------------------------------------------------------------------------
+class ArenaScope {
+public:
+	ArenaScope() : mark(arenaUsed) {
+	}
+
+	~ArenaScope() {
+		arenaUsed = mark;
+	}
+
+private:
+	size_t mark;
+};
@@ -0,0 +1,89 @@
+/**
+ * UDP "I'm awake" beacon.
+ *
+ * beaconSend() announces the device as soon as its web server listens: one
+ * JSON datagram with MAC, panel type, firmware version and the hash of the last
+ * shown frame goes to the configured collector or to the subnet broadcast. The
+ * collector can push an upload right away or answer "NOWORK", which sends the
+ * device back to sleep without waiting for the end of the server window.
+ * "NOWORK <seconds>" also tells when to wake up next (beaconNextWake).
+ * The frame hash (FNV-1a over the upload) is kept in RTC memory over deep sleep.
+ */
+
+const uint16_t BEACON_PORT = 4210;
+const uint32_t BEACON_MAGIC = 0x45504231; // "EPB1"
+const uint32_t BEACON_RTC_OFFSET = TRACE_RTC_OFFSET + (sizeof(TraceRing) + 3) / 4; // right after the trace ring
+const uint32_t BEACON_HASH_SEED = 2166136261u;
+
+struct BeaconState {
+	uint32_t magic;
+	uint32_t frameHash; // hash of the last shown frame, 0 if unknown
+};
+
+WiFiUDP beaconUdp;
+BeaconState beaconState;
+uint32_t beaconHash;     // hash of the frame being uploaded
+bool isBeaconSent = false;
+bool isBeaconNoWork = false;
+long beaconNextWake = 0; // seconds to the next wake asked for by the collector, 0 for none
+
+// -----------------------------------------------------------------------------------------------------
+void beaconBegin() {
+	if (!ESP.rtcUserMemoryRead(BEACON_RTC_OFFSET, (uint32_t*) &beaconState, sizeof beaconState)
+			|| beaconState.magic != BEACON_MAGIC) {
+		beaconState.magic = BEACON_MAGIC;
+		beaconState.frameHash = 0;
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void beaconFrameStart() {
+	beaconHash = BEACON_HASH_SEED;
+}
+
+// -----------------------------------------------------------------------------------------------------
+void beaconFrameData(const char *data, size_t length) {
+	uint32_t hash = beaconHash;
+	for (size_t i = 0; i < length; ++i) {
+		hash = (hash ^ (uint8_t) data[i]) * 16777619u;
+	}
+	beaconHash = hash;
+}
+
+// -----------------------------------------------------------------------------------------------------
+void beaconFrameShown() {
+	beaconState.frameHash = beaconHash;
+	ESP.rtcUserMemoryWrite(BEACON_RTC_OFFSET, (uint32_t*) &beaconState, sizeof beaconState);
+}
+
+// -----------------------------------------------------------------------------------------------------
+bool beaconSend(const char *host, const char *mac, int panel, int version) {
+	IPAddress address;
+	if (host[0] == '\0') {
+		address = WiFi.broadcastIP();
+	} else if (!WiFi.hostByName(host, address)) {
+		LOG_W("Beacon host unknown");
+		return false;
+	}
+	char json[96];
+	int length = snprintf(json, sizeof json, "{\"mac\":\"%s\",\"panel\":%d,\"fw\":%d,\"frame\":\"%08x\"}",
+			mac, panel, version, (unsigned) beaconState.frameHash);
+	beaconUdp.begin(BEACON_PORT);
+	beaconUdp.beginPacket(address, BEACON_PORT);
+	beaconUdp.write((const uint8_t*) json, length);
+	isBeaconSent = beaconUdp.endPacket();
+	return isBeaconSent;
+}
+
+// -----------------------------------------------------------------------------------------------------
+void beaconPoll() {
+	if (isBeaconSent && beaconUdp.parsePacket() > 0) {
+		char reply[20] = { 0 };
+		beaconUdp.read(reply, sizeof reply - 1);
+		if (strncmp(reply, "NOWORK", 6) == 0) {
+			LOG_I("Beacon: no work");
+			isBeaconNoWork = true;
+			beaconNextWake = atol(reply + 6);
+		}
+	}
+}
@@ -8,9 +8,11 @@ BOARD_DEFINITION="esp8266:esp8266:nodemcuv2:xtal=80,vt=flash,exception=disabled,
 TOOL_VERSION=3.1.0-gcc10.3-e5f9fec
 FS_VERSION=${FS_VERSION}
 IDE_VERSION=10819
+EPD_PANEL=${EPD_PANEL:--1} # index of the only e-Paper type in the image, -1 for all types
 
 # prepare
 mkdir -p /tmp/ESP8266/cache
+web/bundle.sh
 
 # build
 arduino-builder \
@@ -26,6 +28,7 @@ arduino-builder \
 	-warnings=all \
 	-build-cache /tmp/ESP8266/cache \
 	-prefs=build.warn_data_percentage=75 \
+	-prefs=compiler.cpp.extra_flags=-DEPD_PANEL=${EPD_PANEL} \
 	-prefs=runtime.tools.mkspiffs.path=${ARDUINO_RUNTIME}/packages/esp8266/tools/mkspiffs/${TOOL_VERSION} \
 	-prefs=runtime.tools.mkspiffs-${TOOL_VERSION}.path=${ARDUINO_RUNTIME}/packages/esp8266/tools/mkspiffs/${TOOL_VERSION} \
 	-prefs=runtime.tools.xtensa-lx106-elf-gcc.path=${ARDUINO_RUNTIME}/packages/esp8266/tools/xtensa-lx106-elf-gcc/${TOOL_VERSION} \
@@ -50,6 +53,7 @@ arduino-builder \
 	-warnings=all \
 	-build-cache /tmp/ESP8266/cache \
 	-prefs=build.warn_data_percentage=75 \
+	-prefs=compiler.cpp.extra_flags=-DEPD_PANEL=${EPD_PANEL} \
 	-prefs=runtime.tools.mkspiffs.path=${ARDUINO_RUNTIME}/packages/esp8266/tools/mkspiffs/${TOOL_VERSION} \
 	-prefs=runtime.tools.mkspiffs-${TOOL_VERSION}.path=${ARDUINO_RUNTIME}/packages/esp8266/tools/mkspiffs/${TOOL_VERSION} \
 	-prefs=runtime.tools.xtensa-lx106-elf-gcc.path=${ARDUINO_RUNTIME}/packages/esp8266/tools/xtensa-lx106-elf-gcc/${TOOL_VERSION} \
@@ -61,11 +65,30 @@ arduino-builder \
 	-verbose \
 	${INO_FILE}
 
-# upload to local firmware server "volker"
 echo
-echo "uploading to firmware server..."
-scp /tmp/ESP8266/ESPEInk_ESP8266.ino.bin volker:
+echo "image size (EPD_PANEL=${EPD_PANEL}): $(stat -c %s /tmp/ESP8266/ESPEInk_ESP8266.ino.bin) bytes"
 
 echo
 echo "compressing image..."
-gzip -f /tmp/ESP8266/ESPEInk_ESP8266.ino.bin
+gzip -9 -k -f /tmp/ESP8266/ESPEInk_ESP8266.ino.bin
+echo "compressed size: $(stat -c %s /tmp/ESP8266/ESPEInk_ESP8266.ino.bin.gz) bytes"
+
+# sizes of the last build per EPD_PANEL, to compare the universal image with the single panel ones
+SIZES=/tmp/ESP8266/sizes.txt
+touch ${SIZES}
+grep -v "^${EPD_PANEL} " ${SIZES} > ${SIZES}.new
+echo "${EPD_PANEL} $(stat -c %s /tmp/ESP8266/ESPEInk_ESP8266.ino.bin) $(stat -c %s /tmp/ESP8266/ESPEInk_ESP8266.ino.bin.gz)" >> ${SIZES}.new
+sort -n ${SIZES}.new > ${SIZES}
+rm ${SIZES}.new
+echo
+printf "%9s %10s %10s\n" EPD_PANEL image gzip
+while read panel image compressed; do
+	printf "%9s %10s %10s\n" ${panel} ${image} ${compressed}
+done < ${SIZES}
+# getUpdate() verifies an image against <image>.md5, if the server has it
+(cd /tmp/ESP8266 && md5sum ESPEInk_ESP8266.ino.bin > ESPEInk_ESP8266.ino.bin.md5 && md5sum ESPEInk_ESP8266.ino.bin.gz > ESPEInk_ESP8266.ino.bin.gz.md5)
+
+# upload to local firmware server "volker"
+echo
+echo "uploading to firmware server..."
+scp /tmp/ESP8266/ESPEInk_ESP8266.ino.bin* volker:
@@ -0,0 +1,44 @@
+/**
+ * CPU clock switching.
+ *
+ * Uploads (receiving, decoding and clocking out frame data) are CPU bound and
+ * run at 160 MHz, the idle server window and the busy waits of the refresh at
+ * 80 MHz. The trace, the profiler and the metrics take their time stamps from
+ * cpuBaseCycles(), a cycle counter at CPU_BASE_MHZ: every stretch of the CPU
+ * cycle counter is scaled by the clock it ran at, cpuBoost() closes the
+ * stretch of the old clock before switching. So a span may cross a switch, and
+ * the difference of two time stamps / CPU_BASE_MHZ are microseconds.
+ * Build with -DCPU_BOOST=0 to stay at the clock of the board definition.
+ */
+
+extern "C" {
+#include <user_interface.h>
+}
+
+#ifndef CPU_BOOST
+#define CPU_BOOST 1
+#endif
+
+const uint32_t CPU_BASE_MHZ = 80;
+
+uint8_t cpuShift;      // log2 of the current clock in CPU_BASE_MHZ
+uint32_t cpuBase;      // cycles at CPU_BASE_MHZ up to cpuLastCycle
+uint32_t cpuLastCycle; // CPU cycle counter when cpuBase was brought up to date
+
+// -----------------------------------------------------------------------------------------------------
+uint32_t cpuBaseCycles() {
+	uint32_t cycles = ESP.getCycleCount() - cpuLastCycle;
+	cpuBase += cycles >> cpuShift;
+	// the cycles that do not make up a full base cycle yet count towards the next call
+	cpuLastCycle += cycles & ~((1UL << cpuShift) - 1);
+	return cpuBase;
+}
+
+// -----------------------------------------------------------------------------------------------------
+void cpuBoost(bool isBoosted) {
+	cpuBaseCycles();
+#if CPU_BOOST
+	system_update_cpu_freq(isBoosted ? SYS_CPU_160MHZ : SYS_CPU_80MHZ);
+#endif
+	cpuShift = ESP.getCpuFreqMHz() > CPU_BASE_MHZ ? 1 : 0;
+}
@@ -3,10 +3,15 @@ public:
 	Ctx() :
 		connectionErrorCount(0),
 					mqttPort(1883),
-					sleepTime(60) {
+					sleepTime(60),
+					sleepMax(0),
+					wakeAlign(0),
+					wakeOffset(0),
+					panelIndex(-1) {
 		memset(mqttUser, 0, 128);
 		memset(mqttPassword, 0, 128);
 		memset(mqttClientName, 0, 21);
+		memset(beaconHost, 0, 40);
 		strcpy(mqttUpdateStatusTopic, "stat/display/needUpdate");
 		strcpy(mqttCommandTopic, "cmd/display/upload");
 	}
@@ -32,9 +37,21 @@ public:
 		if (customSleepTime) {
 			delete customSleepTime;
 		}
+		if (customSleepMax) {
+			delete customSleepMax;
+		}
+		if (customWakeAlign) {
+			delete customWakeAlign;
+		}
+		if (customWakeOffset) {
+			delete customWakeOffset;
+		}
 		if (customFirmwareUrl) {
 			delete customFirmwareUrl;
 		}
+		if (customBeaconHost) {
+			delete customBeaconHost;
+		}
 	}
 	void initWifiManagerParameters() {
 		customMqttServer = new WiFiManagerParameter("server", "MQTT server", mqttServer, 40);
@@ -46,7 +63,14 @@ public:
 		customMqttCommandTopic = new WiFiManagerParameter("commandTopic", "MQTT command topic", mqttCommandTopic, 128);
 		itoa(sleepTime, sleepTimeAsString, 10);
 		customSleepTime = new WiFiManagerParameter("sleepTime", "sleep time in seconds", sleepTimeAsString, 33);
+		itoa(sleepMax, sleepMaxAsString, 10);
+		customSleepMax = new WiFiManagerParameter("sleepMax", "maximum sleep time in seconds (adaptive, 0 = off)", sleepMaxAsString, 8);
+		itoa(wakeAlign, wakeAlignAsString, 10);
+		customWakeAlign = new WiFiManagerParameter("wakeAlign", "align wakes to multiples of seconds (0 = off)", wakeAlignAsString, 8);
+		itoa(wakeOffset, wakeOffsetAsString, 10);
+		customWakeOffset = new WiFiManagerParameter("wakeOffset", "seconds after the aligned time", wakeOffsetAsString, 8);
 		customFirmwareUrl = new WiFiManagerParameter("firmwareUrl", "base URL for firmware images", firmwareUrl, 128);
+		customBeaconHost = new WiFiManagerParameter("beaconHost", "beacon collector (empty for broadcast)", beaconHost, 40);
 	}
 	void updateParameters() {
 		strcpy(mqttServer, customMqttServer->getValue());
@@ -56,7 +80,11 @@ public:
 		strcpy(mqttUpdateStatusTopic, customMqttUpdateStatusTopic->getValue());
 		strcpy(mqttCommandTopic, customMqttCommandTopic->getValue());
 		sleepTime = atoi(customSleepTime->getValue());
+		sleepMax = atoi(customSleepMax->getValue());
+		wakeAlign = atoi(customWakeAlign->getValue());
+		wakeOffset = atoi(customWakeOffset->getValue());
 		strcpy(firmwareUrl, customFirmwareUrl->getValue());
+		strcpy(beaconHost, customBeaconHost->getValue());
 	}
 	bool isMqttEnabled() {
 		return (mqttServer && strlen(mqttServer) > 0);
@@ -73,7 +101,15 @@ public:
 	char mqttCommandTopic[128];
 	char sleepTimeAsString[33];
 	long sleepTime;
+	char sleepMaxAsString[8];
+	long sleepMax;
+	char wakeAlignAsString[8];
+	long wakeAlign;
+	char wakeOffsetAsString[8];
+	long wakeOffset;
 	char firmwareUrl[128];
+	char beaconHost[40];
+	int panelIndex;
 
 	WiFiManagerParameter *customMqttServer;
 	WiFiManagerParameter *customMqttPort;
@@ -82,5 +118,9 @@ public:
 	WiFiManagerParameter *customMqttUpdateStatusTopic;
 	WiFiManagerParameter *customMqttCommandTopic;
 	WiFiManagerParameter *customSleepTime;
+	WiFiManagerParameter *customSleepMax;
+	WiFiManagerParameter *customWakeAlign;
+	WiFiManagerParameter *customWakeOffset;
 	WiFiManagerParameter *customFirmwareUrl;
+	WiFiManagerParameter *customBeaconHost;
 };
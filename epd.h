@@ -14,11 +14,19 @@
               void EPD_Send_4(byte c, byte v1, byte v2, byte v3, byte v4);
               void EPD_Send_5(byte c, byte v1, byte v2, byte v3, byte v4, byte v5);
               void EPD_Reset();
-              void EPD_dispInit();
+              int EPD_Run(const byte *program);
+              int EPD_dispInit();
+              void EPD_dispPrepare(int index);
+              bool EPD_isAvailable(int index);
+              void EPD_dispRelease();
+              void EPD_select(int panel);
 
              varualbes:
               EPD_dispLoad;                - pointer on current loading function
               EPD_dispIndex;               - index of current e-Paper
+              EPD_dispPlanes;              - black and red channel in one stream
+              EPD_dispReady;               - e-Paper is initialized ahead of the upload
+              EPD_panel;                   - panel instance the above belong to
               EPD_dispInfo EPD_dispMass[]; - array of e-Paper properties
 
   ******************************************************************************
@@ -29,11 +37,43 @@
 extern ESP8266WebServer server;
 
 /* SPI pin definition --------------------------------------------------------*/
+// SCLK, MOSI and DC are shared by all panels, every panel has its own CS, BUSY
+// and RST line, given as {CS, BUSY, RST} per panel, e.g. for a second panel:
+// -DEPD_PANEL_PINS="{15,5,2},{16,12,0}". EPD_NO_PIN as RST: the reset of the
+// panel is wired to the reset of the ESP and happens on every wake.
+#define EPD_NO_PIN 0xFF
+#ifndef EPD_PANEL_PINS
+#define EPD_PANEL_PINS {15, 5, 2}
+#endif
+
+struct EPD_panelPins
+{
+    byte cs;
+    byte busy;
+    byte rst;
+};
+
+const EPD_panelPins EPD_pins[] = {EPD_PANEL_PINS};
+const int EPD_PANELS = sizeof EPD_pins / sizeof EPD_pins[0];
+int EPD_panel; // The selected panel, see EPD_select()
+
 // SPI pin definition
-#define CS_PIN 15
-#define RST_PIN 2
+#define CS_PIN (EPD_pins[EPD_panel].cs)
+#define RST_PIN (EPD_pins[EPD_panel].rst)
 #define DC_PIN 4
-#define BUSY_PIN 5
+#define BUSY_PIN (EPD_pins[EPD_panel].busy)
+
+/* Build for a single e-Paper type ------------------------------------------*/
+// -DEPD_PANEL=<index into EPD_dispMass> (EPD_PANEL=<index> for build.sh) leaves
+// the other entries of EPD_dispMass empty, so the linker drops their init, load
+// and show functions and init programs and the web UI offers only that type.
+// The default -1 keeps all types.
+#ifndef EPD_PANEL
+#define EPD_PANEL -1
+#endif
+#define EPD_USED(index) (EPD_PANEL < 0 || EPD_PANEL == (index))
+#define EPD_WITH(index, value) (EPD_USED(index) ? (value) : 0)
+#define EPD_WITH_PTR(index, pointer) (EPD_USED(index) ? (pointer) : nullptr)
 
 /* Pin level definition ------------------------------------------------------*/
 #define LOW 0
@@ -42,35 +82,51 @@ extern ESP8266WebServer server;
 #define GPIO_PIN_SET 1
 #define GPIO_PIN_RESET 0
 
+/* Optional blanking refresh during init (2.13 V2 and V3) --------------------*/
+// The image is written over the whole RAM anyway, so an extra refresh cycle
+// in init only flashes the e-Paper, build with -DEPD_INIT_REFRESH=1 to get it
+#ifndef EPD_INIT_REFRESH
+#define EPD_INIT_REFRESH 0
+#endif
+
 /* Lut mono ------------------------------------------------------------------*/
-byte lut_full_mono[] = {
+const byte lut_full_mono[] PROGMEM = {
     0x02, 0x02, 0x01, 0x11, 0x12, 0x12, 0x22, 0x22,
     0x66, 0x69, 0x69, 0x59, 0x58, 0x99, 0x99, 0x88,
     0x00, 0x00, 0x00, 0x00, 0xF8, 0xB4, 0x13, 0x51,
     0x35, 0x51, 0x51, 0x19, 0x01, 0x00};
 
-byte lut_partial_mono[] = {
+const byte lut_partial_mono[] PROGMEM = {
     0x10, 0x18, 0x18, 0x08, 0x18, 0x18, 0x08, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x44, 0x12,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
+/* Statistics of the SPI transfers and busy waits, see metrics.h -----------*/
+unsigned long EPD_spiBytes;  // Bytes sent to the e-Paper
+uint64_t EPD_spiCycles;      // CPU cycles (at CPU_BASE_MHZ) spent sending them
+unsigned long EPD_busyMillis; // Time spent waiting for BUSY, collected per request
+
 /* The procedure of sending a byte to e-Paper by SPI -------------------------*/
 void EpdSpiTransferCallback(byte data)
 {
+    PROFILE_ZONE(PROFILE_SPI);
+    uint32_t start = cpuBaseCycles();
     digitalWrite(CS_PIN, GPIO_PIN_RESET);
     SPI.transfer(data);
     digitalWrite(CS_PIN, GPIO_PIN_SET);
+    EPD_spiCycles += cpuBaseCycles() - start;
+    EPD_spiBytes++;
 }
 
-byte lut_vcom0[] = {15, 0x0E, 0x14, 0x01, 0x0A, 0x06, 0x04, 0x0A, 0x0A, 0x0F, 0x03, 0x03, 0x0C, 0x06, 0x0A, 0x00};
-byte lut_w[] = {15, 0x0E, 0x14, 0x01, 0x0A, 0x46, 0x04, 0x8A, 0x4A, 0x0F, 0x83, 0x43, 0x0C, 0x86, 0x0A, 0x04};
-byte lut_b[] = {15, 0x0E, 0x14, 0x01, 0x8A, 0x06, 0x04, 0x8A, 0x4A, 0x0F, 0x83, 0x43, 0x0C, 0x06, 0x4A, 0x04};
-byte lut_g1[] = {15, 0x8E, 0x94, 0x01, 0x8A, 0x06, 0x04, 0x8A, 0x4A, 0x0F, 0x83, 0x43, 0x0C, 0x06, 0x0A, 0x04};
-byte lut_g2[] = {15, 0x8E, 0x94, 0x01, 0x8A, 0x06, 0x04, 0x8A, 0x4A, 0x0F, 0x83, 0x43, 0x0C, 0x06, 0x0A, 0x04};
-byte lut_vcom1[] = {15, 0x03, 0x1D, 0x01, 0x01, 0x08, 0x23, 0x37, 0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-byte lut_red0[] = {15, 0x83, 0x5D, 0x01, 0x81, 0x48, 0x23, 0x77, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-byte lut_red1[] = {15, 0x03, 0x1D, 0x01, 0x01, 0x08, 0x23, 0x37, 0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+const byte lut_vcom0[] PROGMEM = {15, 0x0E, 0x14, 0x01, 0x0A, 0x06, 0x04, 0x0A, 0x0A, 0x0F, 0x03, 0x03, 0x0C, 0x06, 0x0A, 0x00};
+const byte lut_w[] PROGMEM = {15, 0x0E, 0x14, 0x01, 0x0A, 0x46, 0x04, 0x8A, 0x4A, 0x0F, 0x83, 0x43, 0x0C, 0x86, 0x0A, 0x04};
+const byte lut_b[] PROGMEM = {15, 0x0E, 0x14, 0x01, 0x8A, 0x06, 0x04, 0x8A, 0x4A, 0x0F, 0x83, 0x43, 0x0C, 0x06, 0x4A, 0x04};
+const byte lut_g1[] PROGMEM = {15, 0x8E, 0x94, 0x01, 0x8A, 0x06, 0x04, 0x8A, 0x4A, 0x0F, 0x83, 0x43, 0x0C, 0x06, 0x0A, 0x04};
+const byte lut_g2[] PROGMEM = {15, 0x8E, 0x94, 0x01, 0x8A, 0x06, 0x04, 0x8A, 0x4A, 0x0F, 0x83, 0x43, 0x0C, 0x06, 0x0A, 0x04};
+const byte lut_vcom1[] PROGMEM = {15, 0x03, 0x1D, 0x01, 0x01, 0x08, 0x23, 0x37, 0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+const byte lut_red0[] PROGMEM = {15, 0x83, 0x5D, 0x01, 0x81, 0x48, 0x23, 0x77, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+const byte lut_red1[] PROGMEM = {15, 0x03, 0x1D, 0x01, 0x01, 0x08, 0x23, 0x37, 0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
 /* Sending a byte as a command -----------------------------------------------*/
 void EPD_SendCommand(byte command)
@@ -86,19 +142,54 @@ void EPD_SendData(byte data)
     EpdSpiTransferCallback(data);
 }
 
+/* Sending a block of data bytes in one SPI transfer ------------------------*/
+void EPD_SendDataBlock(const byte *data, int length)
+{
+    PROFILE_ZONE(PROFILE_SPI);
+    uint32_t start = cpuBaseCycles();
+    digitalWrite(DC_PIN, HIGH);
+    digitalWrite(CS_PIN, GPIO_PIN_RESET);
+    SPI.writeBytes((byte *)data, length);
+    digitalWrite(CS_PIN, GPIO_PIN_SET);
+    EPD_spiCycles += cpuBaseCycles() - start;
+    EPD_spiBytes += length;
+
+    // Let the WiFi stack run between bursts
+    yield();
+}
+
+/* Sending the same data byte many times in one SPI transfer ----------------*/
+void EPD_SendDataFill(byte value, unsigned long count)
+{
+    PROFILE_ZONE(PROFILE_SPI);
+    uint32_t start = cpuBaseCycles();
+    digitalWrite(DC_PIN, HIGH);
+    digitalWrite(CS_PIN, GPIO_PIN_RESET);
+    SPI.writePattern(&value, 1, count);
+    digitalWrite(CS_PIN, GPIO_PIN_SET);
+    EPD_spiCycles += cpuBaseCycles() - start;
+    EPD_spiBytes += count;
+}
+
 /* Waiting the e-Paper is ready for further instructions ---------------------*/
 void EPD_WaitUntilIdle()
 {
+    PROFILE_ZONE(PROFILE_BUSY);
+    unsigned long busyStart = millis();
     //0: busy, 1: idle
     while (digitalRead(BUSY_PIN) == 0)
-        delay(100);
+        schedulerDelay(100);
+    EPD_busyMillis += millis() - busyStart;
 }
 
 /* Waiting the e-Paper is ready for further instructions ---------------------*/
 void EPD_WaitUntilIdle_high() 
 {
+    PROFILE_ZONE(PROFILE_BUSY);
+    unsigned long busyStart = millis();
     //1: busy, 0: idle
-    while(digitalRead(BUSY_PIN) == 1) delay(100);    
+    while(digitalRead(BUSY_PIN) == 1) schedulerDelay(100);    
+    EPD_busyMillis += millis() - busyStart;
 }
 
 /* Send a one-argument command -----------------------------------------------*/
@@ -146,38 +237,48 @@ void EPD_Send_5(byte c, byte v1, byte v2, byte v3, byte v4, byte v5)
     EPD_SendData(v5);
 }
 
-/* Writting lut-data into the e-Paper ----------------------------------------*/
-void EPD_lut(byte c, byte l, byte *p)
+/* Writting lut-data from flash into the e-Paper -----------------------------*/
+void EPD_lut(byte c, byte l, const byte *p)
 {
+    PROFILE_ZONE(PROFILE_LUT);
     // lut-data writting initialization
     EPD_SendCommand(c);
 
-    // lut-data writting doing
-    for (int i = 0; i < l; i++, p++)
-        EPD_SendData(*p);
+    // lut-data writting doing, in blocks copied from flash
+    byte buffer[64];
+    while (l > 0)
+    {
+        byte count = l < sizeof buffer ? l : sizeof buffer;
+        memcpy_P(buffer, p, count);
+        EPD_SendDataBlock(buffer, count);
+        p += count;
+        l -= count;
+    }
 }
 
 /* Writting lut-data of the black-white channel ------------------------------*/
-void EPD_SetLutBw(byte *c20, byte *c21, byte *c22, byte *c23, byte *c24)
+void EPD_SetLutBw(const byte *c20, const byte *c21, const byte *c22, const byte *c23, const byte *c24)
 {
-    EPD_lut(0x20, *c20, c20 + 1); //g vcom
-    EPD_lut(0x21, *c21, c21 + 1); //g ww --
-    EPD_lut(0x22, *c22, c22 + 1); //g bw r
-    EPD_lut(0x23, *c23, c23 + 1); //g wb w
-    EPD_lut(0x24, *c24, c24 + 1); //g bb b
+    EPD_lut(0x20, pgm_read_byte(c20), c20 + 1); //g vcom
+    EPD_lut(0x21, pgm_read_byte(c21), c21 + 1); //g ww --
+    EPD_lut(0x22, pgm_read_byte(c22), c22 + 1); //g bw r
+    EPD_lut(0x23, pgm_read_byte(c23), c23 + 1); //g wb w
+    EPD_lut(0x24, pgm_read_byte(c24), c24 + 1); //g bb b
 }
 
 /* Writting lut-data of the red channel --------------------------------------*/
-void EPD_SetLutRed(byte *c25, byte *c26, byte *c27)
+void EPD_SetLutRed(const byte *c25, const byte *c26, const byte *c27)
 {
-    EPD_lut(0x25, *c25, c25 + 1);
-    EPD_lut(0x26, *c26, c26 + 1);
-    EPD_lut(0x27, *c27, c27 + 1);
+    EPD_lut(0x25, pgm_read_byte(c25), c25 + 1);
+    EPD_lut(0x26, pgm_read_byte(c26), c26 + 1);
+    EPD_lut(0x27, pgm_read_byte(c27), c27 + 1);
 }
 
 /* This function is used to 'wake up" the e-Paper from the deep sleep mode ---*/
 void EPD_Reset()
 {
+    if (RST_PIN == EPD_NO_PIN)
+        return;
     digitalWrite(RST_PIN, HIGH);
     delay(50);
     digitalWrite(RST_PIN, LOW);
@@ -186,6 +287,133 @@ void EPD_Reset()
     delay(50);
 }
 
+/* e-Paper command programs --------------------------------------------------*/
+// Init and show sequences stored in flash and run by EPD_Run():
+//   EPD_RESET                  hardware reset
+//   EPD_COMMAND(c)             command without data
+//   EPD_SEND(c, v1, ...)       command with up to 16 data bytes
+//   EPD_WAIT(busy, s)          wait while BUSY reads 'busy', at most s seconds
+//   EPD_DELAY(ms)              delay of up to 255 ms
+//   EPD_LUT(c, lut)            command with a lut of EPD_lutTable
+//   EPD_FILL(v, n)             n data bytes of value v
+//   EPD_END                    end of the program
+#define EPD_OP_END   0
+#define EPD_OP_CMD   1
+#define EPD_OP_WAIT  2
+#define EPD_OP_DELAY 3
+#define EPD_OP_LUT   4
+#define EPD_OP_FILL  5
+#define EPD_OP_RESET 6
+
+#define EPD_NARGS(...) EPD_NARGS_(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1)
+#define EPD_NARGS_(a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, n, ...) n
+
+#define EPD_RESET           EPD_OP_RESET
+#define EPD_COMMAND(c)      EPD_OP_CMD, c, 0
+#define EPD_SEND(c, ...)    EPD_OP_CMD, c, EPD_NARGS(__VA_ARGS__), __VA_ARGS__
+#define EPD_WAIT(busy, s)   EPD_OP_WAIT, busy, s
+#define EPD_DELAY(ms)       EPD_OP_DELAY, ms
+#define EPD_LUT(c, lut)     EPD_OP_LUT, c, lut
+#define EPD_FILL(v, n)      EPD_OP_FILL, v, (n) & 0xFF, ((n) >> 8) & 0xFF, ((n) >> 16) & 0xFF
+#define EPD_END             EPD_OP_END
+
+#define EPD_WAIT_IDLE       EPD_WAIT(0, 60) // like EPD_WaitUntilIdle()
+#define EPD_WAIT_IDLE_HIGH  EPD_WAIT(1, 60) // like EPD_WaitUntilIdle_high()
+
+/* Luts referenced by command programs, see EPD_lutTable ---------------------*/
+enum EPD_lutIndex
+{
+    EPD_LUT_FULL_MONO,
+    EPD_LUT_VCOM0, EPD_LUT_W, EPD_LUT_B, EPD_LUT_G1, EPD_LUT_G2,
+    EPD_LUT_VCOM1, EPD_LUT_RED0, EPD_LUT_RED1,
+    EPD_LUT_VCOMDC_2IN13D, EPD_LUT_WW_2IN13D, EPD_LUT_BW_2IN13D, EPD_LUT_WB_2IN13D, EPD_LUT_BB_2IN13D,
+    EPD_LUT_DC_2IN7, EPD_LUT_WW_2IN7, EPD_LUT_BW_2IN7, EPD_LUT_WB_2IN7, EPD_LUT_BB_2IN7,
+    EPD_LUT_DC_2IN7B, EPD_LUT_WW_2IN7B, EPD_LUT_BW_2IN7B, EPD_LUT_WB_2IN7B, EPD_LUT_BB_2IN7B,
+    EPD_LUT_DC_4IN2, EPD_LUT_WW_4IN2, EPD_LUT_BW_4IN2, EPD_LUT_WB_4IN2, EPD_LUT_BB_4IN2,
+};
+
+struct EPD_lutInfo
+{
+    const byte *data; // lut-data in flash
+    byte length;
+};
+
+extern const EPD_lutInfo EPD_lutTable[] PROGMEM;
+
+/* Running a command program -------------------------------------------------*/
+// Returns 0, or -1 if the panel is still busy when a wait times out; the rest
+// of the program is not sent then
+int EPD_Run(const byte *program)
+{
+    byte buffer[16];
+    while (true)
+    {
+        byte op = pgm_read_byte(program++);
+        switch (op)
+        {
+        case EPD_OP_RESET:
+            EPD_Reset();
+            break;
+
+        case EPD_OP_CMD:
+        {
+            EPD_SendCommand(pgm_read_byte(program++));
+            byte length = pgm_read_byte(program++);
+            if (length > 0)
+            {
+                memcpy_P(buffer, program, length);
+                EPD_SendDataBlock(buffer, length);
+                program += length;
+            }
+            break;
+        }
+
+        case EPD_OP_WAIT:
+        {
+            PROFILE_ZONE(PROFILE_BUSY);
+            byte busy = pgm_read_byte(program++);
+            unsigned long timeout = pgm_read_byte(program++) * 1000UL;
+            unsigned long start = millis();
+            bool isBusy;
+            while ((isBusy = digitalRead(BUSY_PIN) == busy) && millis() - start < timeout)
+                schedulerDelay(10);
+            EPD_busyMillis += millis() - start;
+            if (isBusy)
+            {
+                LOG_E("EPD %d busy timeout", EPD_panel);
+                return -1;
+            }
+            break;
+        }
+
+        case EPD_OP_DELAY:
+            delay(pgm_read_byte(program++));
+            break;
+
+        case EPD_OP_LUT:
+        {
+            byte command = pgm_read_byte(program++);
+            const EPD_lutInfo *lut = &EPD_lutTable[pgm_read_byte(program++)];
+            EPD_lut(command, pgm_read_byte(&lut->length), (const byte *)pgm_read_ptr(&lut->data));
+            break;
+        }
+
+        case EPD_OP_FILL:
+        {
+            byte value = pgm_read_byte(program++);
+            unsigned long count = pgm_read_byte(program) + (pgm_read_byte(program + 1) << 8)
+                    + ((unsigned long)pgm_read_byte(program + 2) << 16);
+            program += 3;
+            EPD_SendDataFill(value, count);
+            break;
+        }
+
+        default:
+            return 0;
+        }
+    }
+}
+
 /* e-Paper initialization functions ------------------------------------------*/
 #include "epd1in54.h"
 #include "epd2in13.h"
@@ -201,103 +429,273 @@ void EPD_Reset()
 #include "epd7in5.h"
 #include "epd7in5_HD.h"
 
+/* Luts referenced by command programs, in order of EPD_lutIndex ------------*/
+// 'used' names the EPD_dispMass entries whose programs use the lut, the luts
+// of types left out by EPD_PANEL are not linked
+#define EPD_LUT_OF(used, lut, length) {(used) ? (lut) : nullptr, length}
+#define EPD_USED_1IN54BC (EPD_USED(1) || EPD_USED(2))
+
+const EPD_lutInfo EPD_lutTable[] PROGMEM = {
+    EPD_LUT_OF(EPD_USED(9), lut_full_mono, 30),
+    EPD_LUT_OF(EPD_USED_1IN54BC, lut_vcom0 + 1, 15), EPD_LUT_OF(EPD_USED_1IN54BC, lut_w + 1, 15),
+    EPD_LUT_OF(EPD_USED_1IN54BC, lut_b + 1, 15), EPD_LUT_OF(EPD_USED_1IN54BC, lut_g1 + 1, 15),
+    EPD_LUT_OF(EPD_USED_1IN54BC, lut_g2 + 1, 15), EPD_LUT_OF(EPD_USED_1IN54BC, lut_vcom1 + 1, 15),
+    EPD_LUT_OF(EPD_USED_1IN54BC, lut_red0 + 1, 15), EPD_LUT_OF(EPD_USED_1IN54BC, lut_red1 + 1, 15),
+    EPD_LUT_OF(EPD_USED(6), lut_vcomDC_2in13d, 44), EPD_LUT_OF(EPD_USED(6), lut_ww_2in13d, 42),
+    EPD_LUT_OF(EPD_USED(6), lut_bw_2in13d, 42), EPD_LUT_OF(EPD_USED(6), lut_wb_2in13d, 42),
+    EPD_LUT_OF(EPD_USED(6), lut_bb_2in13d, 42),
+    EPD_LUT_OF(EPD_USED(7), lut_dc_2in7, 44), EPD_LUT_OF(EPD_USED(7), lut_ww_2in7, 42),
+    EPD_LUT_OF(EPD_USED(7), lut_bw_2in7, 42), EPD_LUT_OF(EPD_USED(7), lut_wb_2in7, 42),
+    EPD_LUT_OF(EPD_USED(7), lut_bb_2in7, 42),
+    EPD_LUT_OF(EPD_USED(8), lut_dc_2in7b, 44), EPD_LUT_OF(EPD_USED(8), lut_ww_2in7b, 42),
+    EPD_LUT_OF(EPD_USED(8), lut_bw_2in7b, 42), EPD_LUT_OF(EPD_USED(8), lut_wb_2in7b, 42),
+    EPD_LUT_OF(EPD_USED(8), lut_bb_2in7b, 42),
+    EPD_LUT_OF(EPD_USED(13), lut_dc_4in2, 44), EPD_LUT_OF(EPD_USED(13), lut_ww_4in2, 42),
+    EPD_LUT_OF(EPD_USED(13), lut_bw_4in2, 42), EPD_LUT_OF(EPD_USED(13), lut_wb_4in2, 42),
+    EPD_LUT_OF(EPD_USED(13), lut_bb_4in2, 42),
+};
+
 int EPD_dispIndex;        // The index of the e-Paper's type
 int EPD_dispX, EPD_dispY; // Current pixel's coordinates (for 2.13 only)
 void (*EPD_dispLoad)();   // Pointer on a image data writting function
+bool EPD_dispPlanes;      // Black and red channel are sent in one 2-bit stream
+File EPD_planeFile;       // Spool file of the red channel while loading both planes
+bool EPD_dispReady;       // EPD_dispIndex is initialized already, see EPD_dispPrepare()
+
+#define EPD_PLANE_FILE "/plane%d.bin" // per panel
+
+/* Name of the spool file of the selected panel ------------------------------*/
+const char *EPD_planeFileName()
+{
+    static char name[16];
+    snprintf(name, sizeof name, EPD_PLANE_FILE, EPD_panel);
+    return name;
+}
 
 /* Image data loading function for a-type e-Paper ----------------------------*/
-void EPD_loadA()
+// 'mask' is 0xFF for displays with inverted memory, 0x00 otherwise
+template <byte mask>
+void EPD_loadBytes()
 {
-    Serial.print("\r\n EPD_loadA");
     int index = 0;
-    String p = server.arg(0);
+    const String &p = server.arg(0);
 
     // Get the length of the image data begin
     int DataLength = p.length() - 8;
 
+    // Bytes are collected and written as one block
+    byte buffer[256];
+    int count = 0;
+
     // Enumerate all of image data bytes
     while (index < DataLength)
     {
         // Get current byte
         int value = ((int)p[index] - 'a') + (((int)p[index + 1] - 'a') << 4);
 
-        // Write the byte into e-Paper's memory
-        EPD_SendData((byte)value);
+        buffer[count++] = (byte)value ^ mask;
+        if (count == sizeof buffer)
+        {
+            EPD_SendDataBlock(buffer, count);
+            count = 0;
+        }
 
         // Increment the current byte index on 2 characters
         index += 2;
     }
+    if (count > 0)
+        EPD_SendDataBlock(buffer, count);
 }
 
-void EPD_loadAFilp()
+void EPD_loadA()
 {
-    Serial.print("\r\n EPD_loadA");
-    int index = 0;
-    String p = server.arg(0);
+    PROFILE_ZONE(PROFILE_LOAD_A);
+    LOG_D("EPD_loadA");
+    EPD_loadBytes<0x00>();
+}
 
-    // Get the length of the image data begin
-    int DataLength = p.length() - 8;
+void EPD_loadAFilp()
+{
+    PROFILE_ZONE(PROFILE_LOAD_A);
+    LOG_D("EPD_loadA");
+    EPD_loadBytes<0xFF>();
+}
 
-    // Enumerate all of image data bytes
-    while (index < DataLength)
-    {
-        // Get current byte
-        int value = ((int)p[index] - 'a') + (((int)p[index + 1] - 'a') << 4);
+/* Pixel expansion tables, one entry of 1, 2 or 4 output bytes per input byte */
+// b-type: 4 2-bit pixels, black to bits 00, white to bits 11, gray to bits 10
+const byte EPD_tableB[256 * 1] PROGMEM = {
+    0x00, 0xC0, 0x80, 0x80, 0x30, 0xF0, 0xB0, 0xB0, 0x20, 0xE0, 0xA0, 0xA0, 0x20, 0xE0, 0xA0, 0xA0,
+    0x0C, 0xCC, 0x8C, 0x8C, 0x3C, 0xFC, 0xBC, 0xBC, 0x2C, 0xEC, 0xAC, 0xAC, 0x2C, 0xEC, 0xAC, 0xAC,
+    0x08, 0xC8, 0x88, 0x88, 0x38, 0xF8, 0xB8, 0xB8, 0x28, 0xE8, 0xA8, 0xA8, 0x28, 0xE8, 0xA8, 0xA8,
+    0x08, 0xC8, 0x88, 0x88, 0x38, 0xF8, 0xB8, 0xB8, 0x28, 0xE8, 0xA8, 0xA8, 0x28, 0xE8, 0xA8, 0xA8,
+    0x03, 0xC3, 0x83, 0x83, 0x33, 0xF3, 0xB3, 0xB3, 0x23, 0xE3, 0xA3, 0xA3, 0x23, 0xE3, 0xA3, 0xA3,
+    0x0F, 0xCF, 0x8F, 0x8F, 0x3F, 0xFF, 0xBF, 0xBF, 0x2F, 0xEF, 0xAF, 0xAF, 0x2F, 0xEF, 0xAF, 0xAF,
+    0x0B, 0xCB, 0x8B, 0x8B, 0x3B, 0xFB, 0xBB, 0xBB, 0x2B, 0xEB, 0xAB, 0xAB, 0x2B, 0xEB, 0xAB, 0xAB,
+    0x0B, 0xCB, 0x8B, 0x8B, 0x3B, 0xFB, 0xBB, 0xBB, 0x2B, 0xEB, 0xAB, 0xAB, 0x2B, 0xEB, 0xAB, 0xAB,
+    0x02, 0xC2, 0x82, 0x82, 0x32, 0xF2, 0xB2, 0xB2, 0x22, 0xE2, 0xA2, 0xA2, 0x22, 0xE2, 0xA2, 0xA2,
+    0x0E, 0xCE, 0x8E, 0x8E, 0x3E, 0xFE, 0xBE, 0xBE, 0x2E, 0xEE, 0xAE, 0xAE, 0x2E, 0xEE, 0xAE, 0xAE,
+    0x0A, 0xCA, 0x8A, 0x8A, 0x3A, 0xFA, 0xBA, 0xBA, 0x2A, 0xEA, 0xAA, 0xAA, 0x2A, 0xEA, 0xAA, 0xAA,
+    0x0A, 0xCA, 0x8A, 0x8A, 0x3A, 0xFA, 0xBA, 0xBA, 0x2A, 0xEA, 0xAA, 0xAA, 0x2A, 0xEA, 0xAA, 0xAA,
+    0x02, 0xC2, 0x82, 0x82, 0x32, 0xF2, 0xB2, 0xB2, 0x22, 0xE2, 0xA2, 0xA2, 0x22, 0xE2, 0xA2, 0xA2,
+    0x0E, 0xCE, 0x8E, 0x8E, 0x3E, 0xFE, 0xBE, 0xBE, 0x2E, 0xEE, 0xAE, 0xAE, 0x2E, 0xEE, 0xAE, 0xAE,
+    0x0A, 0xCA, 0x8A, 0x8A, 0x3A, 0xFA, 0xBA, 0xBA, 0x2A, 0xEA, 0xAA, 0xAA, 0x2A, 0xEA, 0xAA, 0xAA,
+    0x0A, 0xCA, 0x8A, 0x8A, 0x3A, 0xFA, 0xBA, 0xBA, 0x2A, 0xEA, 0xAA, 0xAA, 0x2A, 0xEA, 0xAA, 0xAA
+};
 
-        // Write the byte into e-Paper's memory
-        EPD_SendData(~(byte)value);
+// 7.5 and 5.83: 8 1-bit pixels to 8 4-bit pixels, black to 0000, white to 0011
+const byte EPD_tableD[256 * 4] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x03,  0x00, 0x00, 0x00, 0x30,  0x00, 0x00, 0x00, 0x33,
+    0x00, 0x00, 0x03, 0x00,  0x00, 0x00, 0x03, 0x03,  0x00, 0x00, 0x03, 0x30,  0x00, 0x00, 0x03, 0x33,
+    0x00, 0x00, 0x30, 0x00,  0x00, 0x00, 0x30, 0x03,  0x00, 0x00, 0x30, 0x30,  0x00, 0x00, 0x30, 0x33,
+    0x00, 0x00, 0x33, 0x00,  0x00, 0x00, 0x33, 0x03,  0x00, 0x00, 0x33, 0x30,  0x00, 0x00, 0x33, 0x33,
+    0x00, 0x03, 0x00, 0x00,  0x00, 0x03, 0x00, 0x03,  0x00, 0x03, 0x00, 0x30,  0x00, 0x03, 0x00, 0x33,
+    0x00, 0x03, 0x03, 0x00,  0x00, 0x03, 0x03, 0x03,  0x00, 0x03, 0x03, 0x30,  0x00, 0x03, 0x03, 0x33,
+    0x00, 0x03, 0x30, 0x00,  0x00, 0x03, 0x30, 0x03,  0x00, 0x03, 0x30, 0x30,  0x00, 0x03, 0x30, 0x33,
+    0x00, 0x03, 0x33, 0x00,  0x00, 0x03, 0x33, 0x03,  0x00, 0x03, 0x33, 0x30,  0x00, 0x03, 0x33, 0x33,
+    0x00, 0x30, 0x00, 0x00,  0x00, 0x30, 0x00, 0x03,  0x00, 0x30, 0x00, 0x30,  0x00, 0x30, 0x00, 0x33,
+    0x00, 0x30, 0x03, 0x00,  0x00, 0x30, 0x03, 0x03,  0x00, 0x30, 0x03, 0x30,  0x00, 0x30, 0x03, 0x33,
+    0x00, 0x30, 0x30, 0x00,  0x00, 0x30, 0x30, 0x03,  0x00, 0x30, 0x30, 0x30,  0x00, 0x30, 0x30, 0x33,
+    0x00, 0x30, 0x33, 0x00,  0x00, 0x30, 0x33, 0x03,  0x00, 0x30, 0x33, 0x30,  0x00, 0x30, 0x33, 0x33,
+    0x00, 0x33, 0x00, 0x00,  0x00, 0x33, 0x00, 0x03,  0x00, 0x33, 0x00, 0x30,  0x00, 0x33, 0x00, 0x33,
+    0x00, 0x33, 0x03, 0x00,  0x00, 0x33, 0x03, 0x03,  0x00, 0x33, 0x03, 0x30,  0x00, 0x33, 0x03, 0x33,
+    0x00, 0x33, 0x30, 0x00,  0x00, 0x33, 0x30, 0x03,  0x00, 0x33, 0x30, 0x30,  0x00, 0x33, 0x30, 0x33,
+    0x00, 0x33, 0x33, 0x00,  0x00, 0x33, 0x33, 0x03,  0x00, 0x33, 0x33, 0x30,  0x00, 0x33, 0x33, 0x33,
+    0x03, 0x00, 0x00, 0x00,  0x03, 0x00, 0x00, 0x03,  0x03, 0x00, 0x00, 0x30,  0x03, 0x00, 0x00, 0x33,
+    0x03, 0x00, 0x03, 0x00,  0x03, 0x00, 0x03, 0x03,  0x03, 0x00, 0x03, 0x30,  0x03, 0x00, 0x03, 0x33,
+    0x03, 0x00, 0x30, 0x00,  0x03, 0x00, 0x30, 0x03,  0x03, 0x00, 0x30, 0x30,  0x03, 0x00, 0x30, 0x33,
+    0x03, 0x00, 0x33, 0x00,  0x03, 0x00, 0x33, 0x03,  0x03, 0x00, 0x33, 0x30,  0x03, 0x00, 0x33, 0x33,
+    0x03, 0x03, 0x00, 0x00,  0x03, 0x03, 0x00, 0x03,  0x03, 0x03, 0x00, 0x30,  0x03, 0x03, 0x00, 0x33,
+    0x03, 0x03, 0x03, 0x00,  0x03, 0x03, 0x03, 0x03,  0x03, 0x03, 0x03, 0x30,  0x03, 0x03, 0x03, 0x33,
+    0x03, 0x03, 0x30, 0x00,  0x03, 0x03, 0x30, 0x03,  0x03, 0x03, 0x30, 0x30,  0x03, 0x03, 0x30, 0x33,
+    0x03, 0x03, 0x33, 0x00,  0x03, 0x03, 0x33, 0x03,  0x03, 0x03, 0x33, 0x30,  0x03, 0x03, 0x33, 0x33,
+    0x03, 0x30, 0x00, 0x00,  0x03, 0x30, 0x00, 0x03,  0x03, 0x30, 0x00, 0x30,  0x03, 0x30, 0x00, 0x33,
+    0x03, 0x30, 0x03, 0x00,  0x03, 0x30, 0x03, 0x03,  0x03, 0x30, 0x03, 0x30,  0x03, 0x30, 0x03, 0x33,
+    0x03, 0x30, 0x30, 0x00,  0x03, 0x30, 0x30, 0x03,  0x03, 0x30, 0x30, 0x30,  0x03, 0x30, 0x30, 0x33,
+    0x03, 0x30, 0x33, 0x00,  0x03, 0x30, 0x33, 0x03,  0x03, 0x30, 0x33, 0x30,  0x03, 0x30, 0x33, 0x33,
+    0x03, 0x33, 0x00, 0x00,  0x03, 0x33, 0x00, 0x03,  0x03, 0x33, 0x00, 0x30,  0x03, 0x33, 0x00, 0x33,
+    0x03, 0x33, 0x03, 0x00,  0x03, 0x33, 0x03, 0x03,  0x03, 0x33, 0x03, 0x30,  0x03, 0x33, 0x03, 0x33,
+    0x03, 0x33, 0x30, 0x00,  0x03, 0x33, 0x30, 0x03,  0x03, 0x33, 0x30, 0x30,  0x03, 0x33, 0x30, 0x33,
+    0x03, 0x33, 0x33, 0x00,  0x03, 0x33, 0x33, 0x03,  0x03, 0x33, 0x33, 0x30,  0x03, 0x33, 0x33, 0x33,
+    0x30, 0x00, 0x00, 0x00,  0x30, 0x00, 0x00, 0x03,  0x30, 0x00, 0x00, 0x30,  0x30, 0x00, 0x00, 0x33,
+    0x30, 0x00, 0x03, 0x00,  0x30, 0x00, 0x03, 0x03,  0x30, 0x00, 0x03, 0x30,  0x30, 0x00, 0x03, 0x33,
+    0x30, 0x00, 0x30, 0x00,  0x30, 0x00, 0x30, 0x03,  0x30, 0x00, 0x30, 0x30,  0x30, 0x00, 0x30, 0x33,
+    0x30, 0x00, 0x33, 0x00,  0x30, 0x00, 0x33, 0x03,  0x30, 0x00, 0x33, 0x30,  0x30, 0x00, 0x33, 0x33,
+    0x30, 0x03, 0x00, 0x00,  0x30, 0x03, 0x00, 0x03,  0x30, 0x03, 0x00, 0x30,  0x30, 0x03, 0x00, 0x33,
+    0x30, 0x03, 0x03, 0x00,  0x30, 0x03, 0x03, 0x03,  0x30, 0x03, 0x03, 0x30,  0x30, 0x03, 0x03, 0x33,
+    0x30, 0x03, 0x30, 0x00,  0x30, 0x03, 0x30, 0x03,  0x30, 0x03, 0x30, 0x30,  0x30, 0x03, 0x30, 0x33,
+    0x30, 0x03, 0x33, 0x00,  0x30, 0x03, 0x33, 0x03,  0x30, 0x03, 0x33, 0x30,  0x30, 0x03, 0x33, 0x33,
+    0x30, 0x30, 0x00, 0x00,  0x30, 0x30, 0x00, 0x03,  0x30, 0x30, 0x00, 0x30,  0x30, 0x30, 0x00, 0x33,
+    0x30, 0x30, 0x03, 0x00,  0x30, 0x30, 0x03, 0x03,  0x30, 0x30, 0x03, 0x30,  0x30, 0x30, 0x03, 0x33,
+    0x30, 0x30, 0x30, 0x00,  0x30, 0x30, 0x30, 0x03,  0x30, 0x30, 0x30, 0x30,  0x30, 0x30, 0x30, 0x33,
+    0x30, 0x30, 0x33, 0x00,  0x30, 0x30, 0x33, 0x03,  0x30, 0x30, 0x33, 0x30,  0x30, 0x30, 0x33, 0x33,
+    0x30, 0x33, 0x00, 0x00,  0x30, 0x33, 0x00, 0x03,  0x30, 0x33, 0x00, 0x30,  0x30, 0x33, 0x00, 0x33,
+    0x30, 0x33, 0x03, 0x00,  0x30, 0x33, 0x03, 0x03,  0x30, 0x33, 0x03, 0x30,  0x30, 0x33, 0x03, 0x33,
+    0x30, 0x33, 0x30, 0x00,  0x30, 0x33, 0x30, 0x03,  0x30, 0x33, 0x30, 0x30,  0x30, 0x33, 0x30, 0x33,
+    0x30, 0x33, 0x33, 0x00,  0x30, 0x33, 0x33, 0x03,  0x30, 0x33, 0x33, 0x30,  0x30, 0x33, 0x33, 0x33,
+    0x33, 0x00, 0x00, 0x00,  0x33, 0x00, 0x00, 0x03,  0x33, 0x00, 0x00, 0x30,  0x33, 0x00, 0x00, 0x33,
+    0x33, 0x00, 0x03, 0x00,  0x33, 0x00, 0x03, 0x03,  0x33, 0x00, 0x03, 0x30,  0x33, 0x00, 0x03, 0x33,
+    0x33, 0x00, 0x30, 0x00,  0x33, 0x00, 0x30, 0x03,  0x33, 0x00, 0x30, 0x30,  0x33, 0x00, 0x30, 0x33,
+    0x33, 0x00, 0x33, 0x00,  0x33, 0x00, 0x33, 0x03,  0x33, 0x00, 0x33, 0x30,  0x33, 0x00, 0x33, 0x33,
+    0x33, 0x03, 0x00, 0x00,  0x33, 0x03, 0x00, 0x03,  0x33, 0x03, 0x00, 0x30,  0x33, 0x03, 0x00, 0x33,
+    0x33, 0x03, 0x03, 0x00,  0x33, 0x03, 0x03, 0x03,  0x33, 0x03, 0x03, 0x30,  0x33, 0x03, 0x03, 0x33,
+    0x33, 0x03, 0x30, 0x00,  0x33, 0x03, 0x30, 0x03,  0x33, 0x03, 0x30, 0x30,  0x33, 0x03, 0x30, 0x33,
+    0x33, 0x03, 0x33, 0x00,  0x33, 0x03, 0x33, 0x03,  0x33, 0x03, 0x33, 0x30,  0x33, 0x03, 0x33, 0x33,
+    0x33, 0x30, 0x00, 0x00,  0x33, 0x30, 0x00, 0x03,  0x33, 0x30, 0x00, 0x30,  0x33, 0x30, 0x00, 0x33,
+    0x33, 0x30, 0x03, 0x00,  0x33, 0x30, 0x03, 0x03,  0x33, 0x30, 0x03, 0x30,  0x33, 0x30, 0x03, 0x33,
+    0x33, 0x30, 0x30, 0x00,  0x33, 0x30, 0x30, 0x03,  0x33, 0x30, 0x30, 0x30,  0x33, 0x30, 0x30, 0x33,
+    0x33, 0x30, 0x33, 0x00,  0x33, 0x30, 0x33, 0x03,  0x33, 0x30, 0x33, 0x30,  0x33, 0x30, 0x33, 0x33,
+    0x33, 0x33, 0x00, 0x00,  0x33, 0x33, 0x00, 0x03,  0x33, 0x33, 0x00, 0x30,  0x33, 0x33, 0x00, 0x33,
+    0x33, 0x33, 0x03, 0x00,  0x33, 0x33, 0x03, 0x03,  0x33, 0x33, 0x03, 0x30,  0x33, 0x33, 0x03, 0x33,
+    0x33, 0x33, 0x30, 0x00,  0x33, 0x33, 0x30, 0x03,  0x33, 0x33, 0x30, 0x30,  0x33, 0x33, 0x30, 0x33,
+    0x33, 0x33, 0x33, 0x00,  0x33, 0x33, 0x33, 0x03,  0x33, 0x33, 0x33, 0x30,  0x33, 0x33, 0x33, 0x33
+};
 
-        // Increment the current byte index on 2 characters
-        index += 2;
-    }
-}
+// 7.5b and 5.83b: 4 2-bit pixels to 4 4-bit pixels, white to 0011, red to 0100
+const byte EPD_tableE[256 * 2] PROGMEM = {
+    0x00, 0x00,  0x30, 0x00,  0x00, 0x00,  0x40, 0x00,  0x03, 0x00,  0x33, 0x00,  0x03, 0x00,  0x43, 0x00,
+    0x00, 0x00,  0x30, 0x00,  0x00, 0x00,  0x40, 0x00,  0x04, 0x00,  0x34, 0x00,  0x04, 0x00,  0x44, 0x00,
+    0x00, 0x30,  0x30, 0x30,  0x00, 0x30,  0x40, 0x30,  0x03, 0x30,  0x33, 0x30,  0x03, 0x30,  0x43, 0x30,
+    0x00, 0x30,  0x30, 0x30,  0x00, 0x30,  0x40, 0x30,  0x04, 0x30,  0x34, 0x30,  0x04, 0x30,  0x44, 0x30,
+    0x00, 0x00,  0x30, 0x00,  0x00, 0x00,  0x40, 0x00,  0x03, 0x00,  0x33, 0x00,  0x03, 0x00,  0x43, 0x00,
+    0x00, 0x00,  0x30, 0x00,  0x00, 0x00,  0x40, 0x00,  0x04, 0x00,  0x34, 0x00,  0x04, 0x00,  0x44, 0x00,
+    0x00, 0x40,  0x30, 0x40,  0x00, 0x40,  0x40, 0x40,  0x03, 0x40,  0x33, 0x40,  0x03, 0x40,  0x43, 0x40,
+    0x00, 0x40,  0x30, 0x40,  0x00, 0x40,  0x40, 0x40,  0x04, 0x40,  0x34, 0x40,  0x04, 0x40,  0x44, 0x40,
+    0x00, 0x03,  0x30, 0x03,  0x00, 0x03,  0x40, 0x03,  0x03, 0x03,  0x33, 0x03,  0x03, 0x03,  0x43, 0x03,
+    0x00, 0x03,  0x30, 0x03,  0x00, 0x03,  0x40, 0x03,  0x04, 0x03,  0x34, 0x03,  0x04, 0x03,  0x44, 0x03,
+    0x00, 0x33,  0x30, 0x33,  0x00, 0x33,  0x40, 0x33,  0x03, 0x33,  0x33, 0x33,  0x03, 0x33,  0x43, 0x33,
+    0x00, 0x33,  0x30, 0x33,  0x00, 0x33,  0x40, 0x33,  0x04, 0x33,  0x34, 0x33,  0x04, 0x33,  0x44, 0x33,
+    0x00, 0x03,  0x30, 0x03,  0x00, 0x03,  0x40, 0x03,  0x03, 0x03,  0x33, 0x03,  0x03, 0x03,  0x43, 0x03,
+    0x00, 0x03,  0x30, 0x03,  0x00, 0x03,  0x40, 0x03,  0x04, 0x03,  0x34, 0x03,  0x04, 0x03,  0x44, 0x03,
+    0x00, 0x43,  0x30, 0x43,  0x00, 0x43,  0x40, 0x43,  0x03, 0x43,  0x33, 0x43,  0x03, 0x43,  0x43, 0x43,
+    0x00, 0x43,  0x30, 0x43,  0x00, 0x43,  0x40, 0x43,  0x04, 0x43,  0x34, 0x43,  0x04, 0x43,  0x44, 0x43,
+    0x00, 0x00,  0x30, 0x00,  0x00, 0x00,  0x40, 0x00,  0x03, 0x00,  0x33, 0x00,  0x03, 0x00,  0x43, 0x00,
+    0x00, 0x00,  0x30, 0x00,  0x00, 0x00,  0x40, 0x00,  0x04, 0x00,  0x34, 0x00,  0x04, 0x00,  0x44, 0x00,
+    0x00, 0x30,  0x30, 0x30,  0x00, 0x30,  0x40, 0x30,  0x03, 0x30,  0x33, 0x30,  0x03, 0x30,  0x43, 0x30,
+    0x00, 0x30,  0x30, 0x30,  0x00, 0x30,  0x40, 0x30,  0x04, 0x30,  0x34, 0x30,  0x04, 0x30,  0x44, 0x30,
+    0x00, 0x00,  0x30, 0x00,  0x00, 0x00,  0x40, 0x00,  0x03, 0x00,  0x33, 0x00,  0x03, 0x00,  0x43, 0x00,
+    0x00, 0x00,  0x30, 0x00,  0x00, 0x00,  0x40, 0x00,  0x04, 0x00,  0x34, 0x00,  0x04, 0x00,  0x44, 0x00,
+    0x00, 0x40,  0x30, 0x40,  0x00, 0x40,  0x40, 0x40,  0x03, 0x40,  0x33, 0x40,  0x03, 0x40,  0x43, 0x40,
+    0x00, 0x40,  0x30, 0x40,  0x00, 0x40,  0x40, 0x40,  0x04, 0x40,  0x34, 0x40,  0x04, 0x40,  0x44, 0x40,
+    0x00, 0x04,  0x30, 0x04,  0x00, 0x04,  0x40, 0x04,  0x03, 0x04,  0x33, 0x04,  0x03, 0x04,  0x43, 0x04,
+    0x00, 0x04,  0x30, 0x04,  0x00, 0x04,  0x40, 0x04,  0x04, 0x04,  0x34, 0x04,  0x04, 0x04,  0x44, 0x04,
+    0x00, 0x34,  0x30, 0x34,  0x00, 0x34,  0x40, 0x34,  0x03, 0x34,  0x33, 0x34,  0x03, 0x34,  0x43, 0x34,
+    0x00, 0x34,  0x30, 0x34,  0x00, 0x34,  0x40, 0x34,  0x04, 0x34,  0x34, 0x34,  0x04, 0x34,  0x44, 0x34,
+    0x00, 0x04,  0x30, 0x04,  0x00, 0x04,  0x40, 0x04,  0x03, 0x04,  0x33, 0x04,  0x03, 0x04,  0x43, 0x04,
+    0x00, 0x04,  0x30, 0x04,  0x00, 0x04,  0x40, 0x04,  0x04, 0x04,  0x34, 0x04,  0x04, 0x04,  0x44, 0x04,
+    0x00, 0x44,  0x30, 0x44,  0x00, 0x44,  0x40, 0x44,  0x03, 0x44,  0x33, 0x44,  0x03, 0x44,  0x43, 0x44,
+    0x00, 0x44,  0x30, 0x44,  0x00, 0x44,  0x40, 0x44,  0x04, 0x44,  0x34, 0x44,  0x04, 0x44,  0x44, 0x44
+};
 
-/* Image data loading function for b-type e-Paper ----------------------------*/
-void EPD_loadB()
+/* Image data loading through a pixel expansion table -----------------------*/
+void EPD_loadTable(const byte *table, int width)
 {
-    Serial.print("\r\n EPD_loadB");
     int index = 0;
-    String p = server.arg(0);
+    const String &p = server.arg(0);
 
     // Get the length of the image data begin
     int DataLength = p.length() - 8;
 
+    // Expanded bytes are collected and written as one block
+    byte buffer[256];
+    int count = 0;
+
     // Enumerate all of image data bytes
     while (index < DataLength)
     {
         // Get current byte from obtained image data
-        int valueA = ((int)p[index] - 'a') + (((int)p[index + 1] - 'a') << 4);
-        int valueB = 0;
+        int value = ((int)p[index] - 'a') + (((int)p[index + 1] - 'a') << 4);
 
-        // Enumerate next 8 pixels
-        for (int i = 0; i < 4; i++)
+        // Look up its expansion
+        memcpy_P(buffer + count, table + value * width, width);
+        count += width;
+        if (count > (int)sizeof buffer - width)
         {
-            // Current obtained pixel data
-            int temp = valueA & 0x03;
-
-            // Remove the obtained pixel data from 'valueA' word
-            valueA = valueA >> 2;
-
-            // Processing of 8 2-bit pixels to 8 2-bit pixels:
-            // black(value 0) to bits 00, white(value 1) to bits 11, gray(otherwise) to bits 10
-            valueB = (valueB << 2);
-            valueB += (temp == 1 ? 3 : (temp == 0 ? 0 : 2));
+            EPD_SendDataBlock(buffer, count);
+            count = 0;
         }
 
-        // Write the word into e-Paper's memory
-        EPD_SendData((byte)valueB);
-
         // Increment the current byte index on 2 characters
         index += 2;
     }
+    if (count > 0)
+        EPD_SendDataBlock(buffer, count);
+}
+
+/* Image data loading function for b-type e-Paper ----------------------------*/
+void EPD_loadB()
+{
+    PROFILE_ZONE(PROFILE_LOAD_B);
+    LOG_D("EPD_loadB");
+    EPD_loadTable(EPD_tableB, 1);
 }
 
 /* Image data loading function for 2.13 e-Paper ------------------------------*/
 void EPD_loadC()
 {
-    Serial.print("\r\n EPD_loadC");
+    PROFILE_ZONE(PROFILE_LOAD_C);
+    LOG_D("EPD_loadC");
     int index = 0;
-    String p = server.arg(0);
+    const String &p = server.arg(0);
 	// Serial.println(p);
     // Get the length of the image data begin
     int DataLength = p.length() - 8;
@@ -339,92 +737,26 @@ void EPD_loadC()
 /* Image data loading function for 7.5 e-Paper -------------------------------*/
 void EPD_loadD()
 {
-    Serial.print("\r\n EPD_loadD");
-    int index = 0;
-    String p = server.arg(0);
-
-    // Get the length of the image data begin
-    int DataLength = p.length() - 8;
-
-    // Enumerate all of image data bytes
-    while (index < DataLength)
-    {
-        // Get current byte from obtained image data
-        int value = ((int)p[index] - 'a') + (((int)p[index + 1] - 'a') << 4);
-        ;
-
-        // Processing of 4 1-bit pixels to 4 4-bit pixels:
-        // black(value 0) to bits 0000, white(value 1) to bits 0011
-        for (int i = 0; i < 4; i++)
-        {
-            int temp = 0;
-            if (value & 0x80)
-            {
-                temp = 0x30;
-            }
-            value = value << 1;
-            if (value & 0x80)
-            {
-                temp |= 0x03;
-            }
-            value = value << 1;
-            EPD_SendData((byte)temp);
-        }
-        // Increment the current byte index on 2 characters
-        index += 2;
-    }
+    PROFILE_ZONE(PROFILE_LOAD_D);
+    LOG_D("EPD_loadD");
+    EPD_loadTable(EPD_tableD, 4);
 }
 
 /* Image data loading function for 7.5b e-Paper ------------------------------*/
 void EPD_loadE()
 {
-    Serial.print("\r\n EPD_loadE");
-    int index = 0;
-    String p = server.arg(0);
-
-    // Get the length of the image data begin
-    int DataLength = p.length() - 8;
-
-    // Enumerate all of image data bytes
-    while (index < DataLength)
-    {
-        // Get current byte from obtained image data
-        int value = ((int)p[index] - 'a') + (((int)p[index + 1] - 'a') << 4);
-        ;
-        for (int i = 0; i < 2; i++)
-        {
-            int temp = 0;
-            if ((value & 0x03) == 0x03)
-            {
-                temp = 0x40;
-            }
-            else if ((value & 0x03) == 0x01)
-            {
-                temp = 0x30;
-            }
-            value = value >> 2;
-            if ((value & 0x03) == 0x03)
-            {
-                temp |= 0x04;
-            }
-            else if ((value & 0x03) == 0x01)
-            {
-                temp |= 0x03;
-            }
-            value = value >> 2;
-            EPD_SendData((byte)temp);
-        }
-        // Increment the current byte index on 2 characters
-        index += 2;
-    }
+    PROFILE_ZONE(PROFILE_LOAD_E);
+    LOG_D("EPD_loadE");
+    EPD_loadTable(EPD_tableE, 2);
 }
 
 /* Image data loading function for 5.65f e-Paper -----------------------------*/
 void EPD_loadG()
 {
-    Serial.print("\r\n EPD_loadG");
+    PROFILE_ZONE(PROFILE_LOAD_G);
+    LOG_D("EPD_loadG");
     int index = 0;
-    String p = server.arg(0);
+    const String &p = server.arg(0);
 
     // Get the length of the image data begin
     int DataLength = p.length() - 8;
@@ -449,88 +781,91 @@ void EPD_loadG()
 }
 
 /* Show image and turn to deep sleep mode (a-type, 4.2 and 2.7 e-Paper) ------*/
-void EPD_showA()
-{
-    Serial.print("\r\n EPD_showA");
+const byte EPD_showA_prog[] PROGMEM = {
     // Refresh
-    EPD_Send_1(0x22, 0xC4); //DISPLAY_UPDATE_CONTROL_2
-    EPD_SendCommand(0x20);  //MASTER_ACTIVATION
-    EPD_SendCommand(0xFF);  //TERMINATE_FRAME_READ_WRITE
-    EPD_WaitUntilIdle();
+    EPD_SEND(0x22, 0xC4),   //DISPLAY_UPDATE_CONTROL_2
+    EPD_COMMAND(0x20),      //MASTER_ACTIVATION
+    EPD_COMMAND(0xFF),      //TERMINATE_FRAME_READ_WRITE
+    EPD_WAIT_IDLE,
 
     // Sleep
-    EPD_SendCommand(0x10); //DEEP_SLEEP_MODE
-    EPD_WaitUntilIdle();
+    EPD_COMMAND(0x10),      //DEEP_SLEEP_MODE
+    EPD_WAIT_IDLE,
+    EPD_END
+};
+
+void EPD_showA()
+{
+    LOG_I("EPD_showA");
+    EPD_Run(EPD_showA_prog);
 }
 
 /* Show image and turn to deep sleep mode (b-type, e-Paper) ------------------*/
-void EPD_showB()
-{
-    Serial.print("\r\n EPD_showB");
+const byte EPD_showB_prog[] PROGMEM = {
     // Refresh
-    EPD_SendCommand(0x12); //DISPLAY_REFRESH
-    delay(100);
-    EPD_WaitUntilIdle();
+    EPD_COMMAND(0x12),                      //DISPLAY_REFRESH
+    EPD_DELAY(100),
+    EPD_WAIT_IDLE,
 
     // Sleep
-    EPD_Send_1(0x50, 0x17);                   //VCOM_AND_DATA_INTERVAL_SETTING
-    EPD_Send_1(0x82, 0x00);                   //VCM_DC_SETTING_REGISTER, to solve Vcom drop
-    EPD_Send_4(0x01, 0x02, 0x00, 0x00, 0x00); //POWER_SETTING
-    EPD_WaitUntilIdle();
-    EPD_SendCommand(0x02); //POWER_OFF
+    EPD_SEND(0x50, 0x17),                   //VCOM_AND_DATA_INTERVAL_SETTING
+    EPD_SEND(0x82, 0x00),                   //VCM_DC_SETTING_REGISTER, to solve Vcom drop
+    EPD_SEND(0x01, 0x02, 0x00, 0x00, 0x00), //POWER_SETTING
+    EPD_WAIT_IDLE,
+    EPD_COMMAND(0x02),                      //POWER_OFF
+    EPD_END
+};
+
+void EPD_showB()
+{
+    LOG_I("EPD_showB");
+    EPD_Run(EPD_showB_prog);
 }
 
 /* Show image and turn to deep sleep mode (7.5 and 7.5b e-Paper) -------------*/
-void EPD_showC()
-{
-    Serial.print("\r\n EPD_showC");
+const byte EPD_showC_prog[] PROGMEM = {
     // Refresh
-    EPD_SendCommand(0x12); //DISPLAY_REFRESH
-    delay(100);
-    EPD_WaitUntilIdle();
+    EPD_COMMAND(0x12),      //DISPLAY_REFRESH
+    EPD_DELAY(100),
+    EPD_WAIT_IDLE,
 
     // Sleep
-    EPD_SendCommand(0x02); // POWER_OFF
-    EPD_WaitUntilIdle();
-    EPD_Send_1(0x07, 0xA5); // DEEP_SLEEP
-}
+    EPD_COMMAND(0x02),      //POWER_OFF
+    EPD_WAIT_IDLE,
+    EPD_SEND(0x07, 0xA5),   //DEEP_SLEEP
+    EPD_END
+};
 
-void EPD_showD()
+void EPD_showC()
 {
-    Serial.print("\r\n EPD_showD");
+    LOG_I("EPD_showC");
+    EPD_Run(EPD_showC_prog);
+}
+
+const byte EPD_showD_prog[] PROGMEM = {
     // VCOM AND DATA INTERVAL SETTING
     // WBmode:VBDF 17, D7 VBDW 97, VBDB 57
     // WBRmode:VBDF F7, VBDW 77, VBDB 37, VBDR B7
-    EPD_Send_1(0x50, 0x97);
-
-    EPD_SendCommand(0x20);
-    for (int count = 0; count < 44; count++)
-        EPD_SendData(lut_vcomDC_2in13d[count]);
-
-    EPD_SendCommand(0x21);
-    for (int count = 0; count < 42; count++)
-        EPD_SendData(lut_ww_2in13d[count]);
-
-    EPD_SendCommand(0x22);
-    for (int count = 0; count < 42; count++)
-        EPD_SendData(lut_bw_2in13d[count]);
-
-    EPD_SendCommand(0x23);
-    for (int count = 0; count < 42; count++)
-        EPD_SendData(lut_wb_2in13d[count]);
-
-    EPD_SendCommand(0x24);
-    for (int count = 0; count < 42; count++)
-        EPD_SendData(lut_bb_2in13d[count]);
-
-    delay(10);
-    EPD_SendCommand(0x12); //DISPLAY REFRESH
-    delay(100);            //!!!The delay here is necessary, 200uS at least!!!
-    EPD_WaitUntilIdle();
+    EPD_SEND(0x50, 0x97),
+    EPD_LUT(0x20, EPD_LUT_VCOMDC_2IN13D),
+    EPD_LUT(0x21, EPD_LUT_WW_2IN13D),
+    EPD_LUT(0x22, EPD_LUT_BW_2IN13D),
+    EPD_LUT(0x23, EPD_LUT_WB_2IN13D),
+    EPD_LUT(0x24, EPD_LUT_BB_2IN13D),
+    EPD_DELAY(10),
+    EPD_COMMAND(0x12),      //DISPLAY REFRESH
+    EPD_DELAY(100),         //!!!The delay here is necessary, 200uS at least!!!
+    EPD_WAIT_IDLE,
+    EPD_SEND(0x50, 0xf7),
+    EPD_COMMAND(0x02),      //POWER_OFF
+    EPD_SEND(0x07, 0xA5),   //DEEP_SLEEP
+    EPD_END
+};
 
-    EPD_Send_1(0x50, 0xf7);
-    EPD_SendCommand(0x02);  //POWER_OFF
-    EPD_Send_1(0x07, 0xA5); //DEEP_SLEEP
+void EPD_showD()
+{
+    LOG_I("EPD_showD");
+    EPD_Run(EPD_showD_prog);
 }
 
 /* The set of pointers on 'init', 'load' and 'show' functions, title and code */
@@ -541,66 +876,307 @@ struct EPD_dispInfo
     int next;       // Change channel code
     void (*chRd)(); // Red channel loading
     void (*show)(); // Show and sleep
-    char *title;    // Title of an e-Paper
+    const char *title; // Title of an e-Paper, 0 if left out of the build
+    int width;      // Resolution of the image data sent by the client
+    int height;
+    int palette;    // Palette of the client, bit 0 set: colored display
+    byte mode;      // Upload sequence of the web client, see EPD_uploadModeOf()
+    byte planes;    // EPD_PLANES_* flags, see EPD_planesOf()
 };
 
+/* Upload sequence of the web client for an e-Paper --------------------------*/
+// 0: black channel, 1 bit per pixel
+// 1: black channel, 2 bits per pixel
+// 2: 7 colors, 4 bits per pixel
+// 3: black channel, line by line (2.13)
+// 4: black and red channel, line by line (2.13)
+// 5: black and red channel, 1 bit per pixel
+// 6: black channel 2 bits and red channel 1 bit per pixel
+// Evaluated by the compiler, so the loaders compared against are not linked
+// into a build for another e-Paper type
+constexpr byte EPD_uploadModeOf(void (*chBk)(), int next, void (*chRd)())
+{
+    return chBk == EPD_loadC ? (next == -1 ? 3 : 4)
+            : chBk == EPD_loadG ? 2
+            : chBk == EPD_loadE ? 1
+            : next == -1 || chRd == 0 ? 0
+            : chBk == EPD_loadB ? 6
+            : 5;
+}
+
+/* Both channels of an e-Paper can be loaded in one stream -------------------*/
+#define EPD_PLANES           1
+#define EPD_PLANES_BLACK_INV 2 // black channel written inverted (EPD_loadAFilp)
+#define EPD_PLANES_RED_INV   4 // red channel written inverted (EPD_loadAFilp)
+
+constexpr bool EPD_isByteLoader(void (*load)())
+{
+    return load == EPD_loadA || load == EPD_loadAFilp;
+}
+
+constexpr byte EPD_planesOf(void (*chBk)(), int next, void (*chRd)())
+{
+    return next != -1 && EPD_isByteLoader(chBk) && EPD_isByteLoader(chRd)
+            ? EPD_PLANES | (chBk == EPD_loadAFilp ? EPD_PLANES_BLACK_INV : 0) | (chRd == EPD_loadAFilp ? EPD_PLANES_RED_INV : 0)
+            : 0;
+}
+
 /* Array of sets describing the usage of e-Papers ----------------------------*/
+#define EPD_DISP(index, init, chBk, next, chRd, show, title, width, height, palette) \
+    {EPD_WITH_PTR(index, init), EPD_WITH_PTR(index, chBk), EPD_WITH(index, next), EPD_WITH_PTR(index, chRd), \
+     EPD_WITH_PTR(index, show), EPD_WITH_PTR(index, title), EPD_WITH(index, width), EPD_WITH(index, height), \
+     EPD_WITH(index, palette), EPD_WITH(index, EPD_uploadModeOf(chBk, next, chRd)), \
+     EPD_WITH(index, EPD_planesOf(chBk, next, chRd))}
+
 EPD_dispInfo EPD_dispMass[] = {
-    {EPD_Init_1in54,		EPD_loadA,		-1,			0, 				EPD_showA,			"1.54 inch"		},	// a 0
-    {EPD_Init_1in54b,		EPD_loadB,		0x13, 		EPD_loadA,		EPD_showB, 			"1.54 inch b"	},	// b 1
-    {EPD_Init_1in54c,		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"1.54 inch c"	},	// c 2
-    {EPD_Init_2in13,		EPD_loadC,		-1, 		0, 				EPD_showA, 			"2.13 inch"		},	// d 3
-    {EPD_Init_2in13b,		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"2.13 inch b"	},	// e 4
-    {EPD_Init_2in13b,		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"2.13 inch c"	},	// f 5
-    {EPD_Init_2in13d, 		EPD_loadA,		-1, 		0, 				EPD_showD, 			"2.13 inch d"	},	// g 6
-    {EPD_Init_2in7, 		EPD_loadA,		-1, 		0, 				EPD_showB, 			"2.7 inch"		},	// h 7
-    {EPD_Init_2in7b, 		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"2.7 inch b"	},	// i 8
-    {EPD_Init_2in9, 		EPD_loadA,		-1,	 		0, 				EPD_showA, 			"2.9 inch"		},	// j 9
-    {EPD_Init_2in9b, 		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"2.9 inch b"	},	// k 10
-    {EPD_Init_2in9b, 		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"2.9 inch c"	},	// l 11
-    {EPD_Init_2in9d, 		EPD_loadA,		-1, 		0, 				EPD_2IN9D_Show,		"2.9 inch d"	},	// l 12
-    {EPD_Init_4in2, 		EPD_loadA, 		-1,	 		0, 				EPD_showB, 			"4.2 inch"		},	// m 13
-    {EPD_Init_4in2b, 		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"4.2 inch b"	},	// n 14
-    {EPD_Init_4in2b, 		EPD_loadA,		0x13, 		EPD_loadA,		EPD_showB, 			"4.2 inch c"	},	// o 15
-    {EPD_5in83__init, 		EPD_loadD, 		-1,			0, 				EPD_showC, 			"5.83 inch"		},	// p 16
-    {EPD_5in83b__init, 		EPD_loadE, 		-1,			0, 				EPD_showC,			"5.83 inch b"	},	// q 17
-    {EPD_5in83b__init, 		EPD_loadE, 		-1,			0, 				EPD_showC, 			"5.83 inch c"	},	// r 18
-    {EPD_7in5__init, 		EPD_loadD, 		-1,			0, 				EPD_showC, 			"7.5 inch"		},	// s 19
-    {EPD_7in5__init, 		EPD_loadE,		-1,			0,				EPD_showC, 			"7.5 inch b"	},	// t 20
-    {EPD_7in5__init, 		EPD_loadE, 		-1, 		0, 				EPD_showC, 			"7.5 inch c"	},	// u 21
-    {EPD_7in5_V2_init,		EPD_loadAFilp,	-1, 		0,				EPD_7IN5_V2_Show,	"7.5 inch V2"	},	// w 22
-    {EPD_7in5B_V2_Init,	 	EPD_loadA,		0x13, 		EPD_loadAFilp, 	EPD_7IN5_V2_Show,	"7.5 inch B V2 "},	// x 23
-	{EPD_7IN5B_HD_init, 	EPD_loadA,		0X26, 		EPD_loadAFilp, 	EPD_7IN5B_HD_Show,	"7.5 inch B HD "},	// y 24
-	{EPD_5IN65F_init,		EPD_loadG,		-1,			0,				EPD_5IN65F_Show,	"5.65 inch F "	},	// z 25
-	{EPD_7IN5_HD_init,		EPD_loadA,		-1,			0,				EPD_7IN5_HD_Show,	"7.5 inch HD"	},	// A 26
-	{EPD_3IN7_1Gray_Init,	EPD_loadA,		-1,			0,				EPD_3IN7_1Gray_Show,"3.7 inch"		},	// 27
-	{EPD_2IN66_Init,		EPD_loadA,		-1,			0,				EPD_2IN66_Show,		"2.66 inch"		},	// 28
-	{EPD_5in83b_V2_init,	EPD_loadA,		0x13,		EPD_loadAFilp,	EPD_showC,			"5.83 inch B V2"},	// 29
-	{EPD_Init_2in9b_V3,		EPD_loadA,		0x13,		EPD_loadA,		EPD_showC,			"2.9 inch B V3"	},	// 30
-	{EPD_1IN54B_V2_Init,	EPD_loadA,		0x26,		EPD_loadAFilp,	EPD_1IN54B_V2_Show,	"1.54 inch B V2"},	// 31
-	{EPD_2IN13B_V3_Init,	EPD_loadA,		0x13,		EPD_loadA,		EPD_2IN13B_V3_Show,	"2.13 inch B V3"},	// 32
-	{EPD_Init_2in9_V2,		EPD_loadA,		-1,			0,				EPD_2IN9_V2_Show,	"2.9 inch V2"	},	// 33
-	{EPD_Init_4in2b_V2,		EPD_loadA,		0x13,		EPD_loadA,		EPD_4IN2B_V2_Show,	"4.2 inch B V2"	},	// 34
-	{EPD_2IN66B_Init,		EPD_loadA,		0x26,		EPD_loadAFilp,	EPD_2IN66_Show,		"2.66 inch B"	},	// 35
-	{EPD_Init_5in83_V2,		EPD_loadAFilp,	-1,			0,				EPD_showC,			"5.83 inch V2"	},	// 36
-	{EPD_4IN01F_init,		EPD_loadG,		-1,			0,				EPD_4IN01F_Show,	"4.01 inch F"	},	// 37
-	{EPD_Init_2in7b_V2,		EPD_loadA,		0x26,		EPD_loadAFilp,	EPD_Show_2in7b_V2,	"2.7 inch B V2"	},	// 38
-	{EPD_Init_2in13_V3,		EPD_loadC,		-1, 		0, 				EPD_2IN13_V3_Show, 	"2.13 inch V3"	},	// 39
-	{EPD_2IN13B_V4_Init,	EPD_loadC,		0x26,		EPD_loadC,		EPD_2IN13B_V4_Show, "2.13 inch B V4"},	// 40
-    { EPD_3IN52_Init,	    EPD_loadA,		-1,	        0,		        EPD_3IN52_Show,     "3.52 inch"     },// 41
-    { EPD_2IN7_V2_Init,		EPD_loadA, 		-1  ,	    0,				EPD_2IN7_V2_Show,	"2.7 inch V2"	},// 42
+    EPD_DISP(0,	EPD_Init_1in54,		EPD_loadA,		-1,			nullptr,			EPD_showA,			"1.54 inch",	200, 200, 0	),	// a 0
+    EPD_DISP(1,	EPD_Init_1in54b,		EPD_loadB,		0x13, 		EPD_loadA,		EPD_showB, 			"1.54 inch b",	200, 200, 3	),	// b 1
+    EPD_DISP(2,	EPD_Init_1in54c,		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"1.54 inch c",	152, 152, 5	),	// c 2
+    EPD_DISP(3,	EPD_Init_2in13,		EPD_loadC,		-1, 		nullptr,			EPD_showA, 			"2.13 inch",	122, 250, 0	),	// d 3
+    EPD_DISP(4,	EPD_Init_2in13b,		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"2.13 inch b",	104, 212, 1	),	// e 4
+    EPD_DISP(5,	EPD_Init_2in13b,		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"2.13 inch c",	104, 212, 5	),	// f 5
+    EPD_DISP(6,	EPD_Init_2in13d, 		EPD_loadA,		-1, 		nullptr,			EPD_showD, 			"2.13 inch d",	104, 212, 0	),	// g 6
+    EPD_DISP(7,	EPD_Init_2in7, 		EPD_loadA,		-1, 		nullptr,			EPD_showB, 			"2.7 inch",	176, 264, 0	),	// h 7
+    EPD_DISP(8,	EPD_Init_2in7b, 		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"2.7 inch b",	176, 264, 1	),	// i 8
+    EPD_DISP(9,	EPD_Init_2in9, 		EPD_loadA,		-1,	 		nullptr,			EPD_showA, 			"2.9 inch",	128, 296, 0	),	// j 9
+    EPD_DISP(10,	EPD_Init_2in9b, 		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"2.9 inch b",	128, 296, 1	),	// k 10
+    EPD_DISP(11,	EPD_Init_2in9b, 		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"2.9 inch c",	128, 296, 5	),	// l 11
+    EPD_DISP(12,	EPD_Init_2in9d, 		EPD_loadA,		-1, 		nullptr,			EPD_2IN9D_Show,		"2.9 inch d",	128, 296, 0	),	// l 12
+    EPD_DISP(13,	EPD_Init_4in2, 		EPD_loadA, 		-1,	 		nullptr,			EPD_showB, 			"4.2 inch",	400, 300, 0	),	// m 13
+    EPD_DISP(14,	EPD_Init_4in2b, 		EPD_loadA,		0x13, 		EPD_loadA, 		EPD_showB, 			"4.2 inch b",	400, 300, 1	),	// n 14
+    EPD_DISP(15,	EPD_Init_4in2b, 		EPD_loadA,		0x13, 		EPD_loadA,		EPD_showB, 			"4.2 inch c",	400, 300, 5	),	// o 15
+    EPD_DISP(16,	EPD_5in83__init, 		EPD_loadD, 		-1,			nullptr,			EPD_showC, 			"5.83 inch",	600, 448, 0	),	// p 16
+    EPD_DISP(17,	EPD_5in83b__init, 		EPD_loadE, 		-1,			nullptr,			EPD_showC,			"5.83 inch b",	600, 448, 1	),	// q 17
+    EPD_DISP(18,	EPD_5in83b__init, 		EPD_loadE, 		-1,			nullptr,			EPD_showC, 			"5.83 inch c",	600, 448, 5	),	// r 18
+    EPD_DISP(19,	EPD_7in5__init, 		EPD_loadD, 		-1,			nullptr,			EPD_showC, 			"7.5 inch",	640, 384, 0	),	// s 19
+    EPD_DISP(20,	EPD_7in5__init, 		EPD_loadE,		-1,			nullptr,			EPD_showC, 			"7.5 inch b",	640, 384, 1	),	// t 20
+    EPD_DISP(21,	EPD_7in5__init, 		EPD_loadE, 		-1, 		nullptr,			EPD_showC, 			"7.5 inch c",	640, 384, 5	),	// u 21
+    EPD_DISP(22,	EPD_7in5_V2_init,		EPD_loadAFilp,	-1, 		nullptr,			EPD_7IN5_V2_Show,	"7.5 inch V2",	800, 480, 0	),	// w 22
+    EPD_DISP(23,	EPD_7in5B_V2_Init,	 	EPD_loadA,		0x13, 		EPD_loadAFilp, 	EPD_7IN5_V2_Show,	"7.5 inch B V2 ",	800, 480, 1	),	// x 23
+	EPD_DISP(24,	EPD_7IN5B_HD_init, 	EPD_loadA,		0X26, 		EPD_loadAFilp, 	EPD_7IN5B_HD_Show,	"7.5 inch B HD ",	880, 528, 1	),	// y 24
+	EPD_DISP(25,	EPD_5IN65F_init,		EPD_loadG,		-1,			nullptr,			EPD_5IN65F_Show,	"5.65 inch F ",	600, 448, 7	),	// z 25
+	EPD_DISP(26,	EPD_7IN5_HD_init,		EPD_loadA,		-1,			nullptr,			EPD_7IN5_HD_Show,	"7.5 inch HD",	880, 528, 0	),	// A 26
+	EPD_DISP(27,	EPD_3IN7_1Gray_Init,	EPD_loadA,		-1,			nullptr,			EPD_3IN7_1Gray_Show,"3.7 inch",	280, 480, 0	),	// 27
+	EPD_DISP(28,	EPD_2IN66_Init,		EPD_loadA,		-1,			nullptr,			EPD_2IN66_Show,		"2.66 inch",	152, 296, 0	),	// 28
+	EPD_DISP(29,	EPD_5in83b_V2_init,	EPD_loadA,		0x13,		EPD_loadAFilp,	EPD_showC,			"5.83 inch B V2",	648, 480, 1	),	// 29
+	EPD_DISP(30,	EPD_Init_2in9b_V3,		EPD_loadA,		0x13,		EPD_loadA,		EPD_showC,			"2.9 inch B V3",	128, 296, 1	),	// 30
+	EPD_DISP(31,	EPD_1IN54B_V2_Init,	EPD_loadA,		0x26,		EPD_loadAFilp,	EPD_1IN54B_V2_Show,	"1.54 inch B V2",	200, 200, 1	),	// 31
+	EPD_DISP(32,	EPD_2IN13B_V3_Init,	EPD_loadA,		0x13,		EPD_loadA,		EPD_2IN13B_V3_Show,	"2.13 inch B V3",	104, 214, 1	),	// 32
+	EPD_DISP(33,	EPD_Init_2in9_V2,		EPD_loadA,		-1,			nullptr,			EPD_2IN9_V2_Show,	"2.9 inch V2",	128, 296, 0	),	// 33
+	EPD_DISP(34,	EPD_Init_4in2b_V2,		EPD_loadA,		0x13,		EPD_loadA,		EPD_4IN2B_V2_Show,	"4.2 inch B V2",	400, 300, 1	),	// 34
+	EPD_DISP(35,	EPD_2IN66B_Init,		EPD_loadA,		0x26,		EPD_loadAFilp,	EPD_2IN66_Show,		"2.66 inch B",	152, 296, 1	),	// 35
+	EPD_DISP(36,	EPD_Init_5in83_V2,		EPD_loadAFilp,	-1,			nullptr,			EPD_showC,			"5.83 inch V2",	648, 480, 0	),	// 36
+	EPD_DISP(37,	EPD_4IN01F_init,		EPD_loadG,		-1,			nullptr,			EPD_4IN01F_Show,	"4.01 inch F",	640, 400, 7	),	// 37
+	EPD_DISP(38,	EPD_Init_2in7b_V2,		EPD_loadA,		0x26,		EPD_loadAFilp,	EPD_Show_2in7b_V2,	"2.7 inch B V2",	176, 264, 1	),	// 38
+	EPD_DISP(39,	EPD_Init_2in13_V3,		EPD_loadC,		-1, 		nullptr,			EPD_2IN13_V3_Show, 	"2.13 inch V3",	122, 250, 0	),	// 39
+	EPD_DISP(40,	EPD_2IN13B_V4_Init,	EPD_loadC,		0x26,		EPD_loadC,		EPD_2IN13B_V4_Show, "2.13 inch B V4",	122, 250, 1	),	// 40
+    EPD_DISP(41,	EPD_3IN52_Init,	    EPD_loadA,		-1,	        nullptr,	        EPD_3IN52_Show,     "3.52 inch",	240, 360, 0	),// 41
+    EPD_DISP(42,	EPD_2IN7_V2_Init,		EPD_loadA, 		-1  ,	    nullptr,			EPD_2IN7_V2_Show,	"2.7 inch V2",	176, 264, 0	),// 42
 };
 
-/* Initialization of an e-Paper ----------------------------------------------*/
-void EPD_dispInit()
+const int EPD_dispCount = sizeof EPD_dispMass / sizeof EPD_dispMass[0];
+static_assert(EPD_PANEL < EPD_dispCount, "EPD_PANEL is not an index into EPD_dispMass");
+
+/* Checks if an e-Paper type is part of this build ---------------------------*/
+bool EPD_isAvailable(int index)
+{
+    return index >= 0 && index < EPD_dispCount && EPD_dispMass[index].init;
+}
+
+/* Upload sequence of the web client for an e-Paper --------------------------*/
+int EPD_uploadMode(int index)
+{
+    return EPD_dispMass[index].mode;
+}
+
+/* Image data loading function for combined black and red channels ----------*/
+void EPD_loadPlanes()
+{
+    PROFILE_ZONE(PROFILE_LOAD_PLANES);
+    LOG_D("EPD_loadPlanes");
+    int index = 0;
+    const String &p = server.arg(0);
+
+    // Get the length of the image data begin
+    int DataLength = p.length() - 8;
+
+    // The black channel is written in blocks, the red one is spooled to flash
+    // and written after the black one
+    byte blackMask = EPD_dispMass[EPD_dispIndex].planes & EPD_PLANES_BLACK_INV ? 0xFF : 0x00;
+    byte redMask = EPD_dispMass[EPD_dispIndex].planes & EPD_PLANES_RED_INV ? 0xFF : 0x00;
+    byte blackBuffer[64];
+    byte buffer[64];
+    int count = 0;
+
+    // Enumerate all of image data words, every word holds 8 2-bit pixels:
+    // black(value 0), white(value 1), gray(value 2), red(value 3)
+    while (index < DataLength)
+    {
+        int value = ((int)p[index] - 'a') + (((int)p[index + 1] - 'a') << 4)
+                + (((int)p[index + 2] - 'a') << 8) + (((int)p[index + 3] - 'a') << 12);
+        byte black = 0;
+        byte red = 0;
+
+        for (int i = 0; i < 8; i++)
+        {
+            int pixel = (value >> (i << 1)) & 0x03;
+            if (pixel != 0) black |= 128 >> i;
+            if (pixel != 3) red |= 128 >> i;
+        }
+
+        blackBuffer[count] = black ^ blackMask;
+        buffer[count++] = red ^ redMask;
+        if (count == sizeof buffer)
+        {
+            EPD_SendDataBlock(blackBuffer, count);
+            EPD_planeFile.write(buffer, count);
+            count = 0;
+        }
+
+        // Increment the current byte index on 4 characters
+        index += 4;
+    }
+    if (count > 0)
+    {
+        EPD_SendDataBlock(blackBuffer, count);
+        EPD_planeFile.write(buffer, count);
+    }
+}
+
+/* Writting the spooled red channel into the e-Paper ------------------------*/
+void EPD_loadSpooled()
+{
+    PROFILE_ZONE(PROFILE_LOAD_SPOOLED);
+    LOG_D("EPD_loadSpooled");
+    EPD_planeFile.close();
+    EPD_dispPlanes = false;
+
+    // Do the selection of the red data channel
+    EPD_SendCommand(EPD_dispMass[EPD_dispIndex].next);
+    delay(2);
+
+    File planeFile = SPIFFS.open(EPD_planeFileName(), "r");
+    if (!planeFile)
+        return;
+
+    byte buffer[256];
+    int count;
+    while ((count = planeFile.read(buffer, sizeof buffer)) > 0)
+        EPD_SendDataBlock(buffer, count);
+    planeFile.close();
+    SPIFFS.remove(EPD_planeFileName());
+}
+
+/* Checks if both channels of an e-Paper can be loaded in one stream --------*/
+bool EPD_isPlanesCapable(int index)
+{
+    return EPD_dispMass[index].planes & EPD_PLANES;
+}
+
+/* Initialization of an e-Paper, returns the result of its init function ----*/
+int EPD_dispInit()
 {
-    // Call initialization function
-    EPD_dispMass[EPD_dispIndex].init();
+    // Call initialization function, unless EPD_dispPrepare() did it already
+    int result = 0;
+    if (!EPD_dispReady)
+        result = EPD_dispMass[EPD_dispIndex].init();
+    EPD_dispReady = false;
+    if (result != 0)
+        return result;
 
     // Set loading function for black channel
     EPD_dispLoad = EPD_dispMass[EPD_dispIndex].chBk;
 
+    // Both channels in one stream, the red one is spooled until SHOW
+    if (EPD_dispPlanes)
+    {
+        EPD_planeFile = SPIFFS.open(EPD_planeFileName(), "w");
+        if (EPD_planeFile)
+            EPD_dispLoad = EPD_loadPlanes;
+        else
+            EPD_dispPlanes = false;
+    }
+
     // Set initial coordinates
     EPD_dispX = 0;
     EPD_dispY = 0;
+    return 0;
+}
+
+/* Initialization of an e-Paper ahead of its upload --------------------------*/
+void EPD_dispPrepare(int index)
+{
+    EPD_dispIndex = index;
+    EPD_dispReady = EPD_dispMass[EPD_dispIndex].init() == 0;
+}
+
+/* Powering down an e-Paper initialized ahead but never uploaded -------------*/
+void EPD_dispRelease()
+{
+    // A hardware reset leaves the controller with its booster switched off
+    if (EPD_dispReady)
+        EPD_Reset();
+    EPD_dispReady = false;
+}
+
+/* State of the panels that are not selected ---------------------------------*/
+struct EPD_panelState
+{
+    int dispIndex;
+    int dispX, dispY;
+    void (*dispLoad)();
+    bool dispPlanes;
+    File planeFile;
+    bool dispReady;
+    UBYTE lutFlag3in52;  // EPD_3IN52_Flag, the lut parity of the 3.52" panel
+};
+
+EPD_panelState EPD_panels[EPD_PANELS];
+
+/* Selecting the panel the driver works on -----------------------------------*/
+// The driver state of the previous panel is put aside and the one of the new
+// panel restored, so the e-Paper functions above stay unaware of instances
+void EPD_select(int panel)
+{
+    if (panel == EPD_panel)
+        return;
+    EPD_panelState &previous = EPD_panels[EPD_panel];
+    previous.dispIndex = EPD_dispIndex;
+    previous.dispX = EPD_dispX;
+    previous.dispY = EPD_dispY;
+    previous.dispLoad = EPD_dispLoad;
+    previous.dispPlanes = EPD_dispPlanes;
+    previous.planeFile = EPD_planeFile;
+    previous.dispReady = EPD_dispReady;
+    previous.lutFlag3in52 = EPD_3IN52_Flag;
+
+    EPD_panel = panel;
+    EPD_panelState &next = EPD_panels[EPD_panel];
+    EPD_dispIndex = next.dispIndex;
+    EPD_dispX = next.dispX;
+    EPD_dispY = next.dispY;
+    EPD_dispLoad = next.dispLoad;
+    EPD_dispPlanes = next.dispPlanes;
+    EPD_planeFile = next.planeFile;
+    EPD_dispReady = next.dispReady;
+    EPD_3IN52_Flag = next.lutFlag3in52;
 }
+
+/* Selecting a panel until the end of the scope ------------------------------*/
+// Busy waits run the scheduler, which may work on another panel meanwhile
+class EPD_PanelScope
+{
+public:
+    EPD_PanelScope(int panel) : previous(EPD_panel)
+    {
+        EPD_select(panel);
+    }
+
+    ~EPD_PanelScope()
+    {
+        EPD_select(previous);
+    }
+
+private:
+    int previous;
+};
@@ -13,7 +13,7 @@ int EPD_Init_1in54()
 {
     int EPD1in54 = 2;
     if(EPD1in54 == 1) {
-        Serial.print("\r\nEPD1in54 V1");
+        LOG_I("EPD1in54 V1");
         EPD_Reset();
         EPD_Send_3(0x01, 199, 0, 00);//DRIVER_OUTPUT_CONTROL: LO(EPD_HEIGHT-1), HI(EPD_HEIGHT-1). GD = 0; SM = 0; TB = 0;
         EPD_Send_3(0x0C, 0xD7, 0xD6, 0x9D);//BOOSTER_SOFT_START_CONTROL
@@ -32,14 +32,14 @@ int EPD_Init_1in54()
         EPD_SendCommand(0x24);//WRITE_RAM
         delay(2);
     } else {
-        Serial.print("\r\nEPD1in54 V2");
+        LOG_I("EPD1in54 V2");
         EPD_Reset();
 
-        Serial.print("\r\nbusy");
-        while (digitalRead(BUSY_PIN) == 1) delay(100);
-        Serial.print("\r\nbusy free");
+        LOG_D("busy");
+        while (digitalRead(BUSY_PIN) == 1) schedulerDelay(100);
+        LOG_D("busy free");
         EPD_SendCommand(0x12);  //SWRESET
-        while (digitalRead(BUSY_PIN) == 1) delay(100);
+        while (digitalRead(BUSY_PIN) == 1) schedulerDelay(100);
 
         EPD_SendCommand(0x01); //Driver output control
         EPD_SendData(0xC7);
@@ -74,97 +74,108 @@ int EPD_Init_1in54()
         EPD_SendCommand(0x4F);   // set RAM y address count to 0X199;
         EPD_SendData(0xC7);
         EPD_SendData(0x00);
-        while (digitalRead(BUSY_PIN) == 1) delay(100);
-        Serial.print("\r\n init over");
+        while (digitalRead(BUSY_PIN) == 1) schedulerDelay(100);
+        LOG_D("init over");
         
         EPD_SendCommand(0x24);//DATA_START_TRANSMISSION_1
     }
     return 0;
 }
 
-int EPD_Init_1in54b()
-{
-    EPD_Reset();
-    EPD_Send_4(0x01, 0x07, 0x00, 0x08, 0x00);//POWER_SETTING
-    EPD_Send_3(0x06, 0x07, 0x07, 0x07);//BOOSTER_SOFT_START
-    EPD_SendCommand(0x04);//POWER_ON
-    EPD_WaitUntilIdle();
-
-    EPD_Send_1(0x00, 0xCF);//PANEL_SETTING
-    EPD_Send_1(0x50, 0x37);//VCOM_AND_DATA_INTERVAL_SETTING
-    EPD_Send_1(0x30, 0x39);//PLL_CONTROL
-    EPD_Send_3(0x61, 0xC8, 0x00, 0xC8);//TCON_RESOLUTION
-    EPD_Send_1(0x82, 0x0E);//VCM_DC_SETTING_REGISTER
-
-    EPD_SetLutBw (&lut_vcom0[0], &lut_w[0], &lut_b[0], &lut_g1[0], &lut_g2[0]);
-    EPD_SetLutRed(&lut_vcom1[0], &lut_red0[0], &lut_red1[0]);
-
-    EPD_SendCommand(0x10);//DATA_START_TRANSMISSION_1
-    delay(2);
-    return 0;
-}
+const byte EPD_Init_1in54b_prog[] PROGMEM = {
+    EPD_RESET,
+    EPD_SEND(0x01, 0x07, 0x00, 0x08, 0x00),//POWER_SETTING
+    EPD_SEND(0x06, 0x07, 0x07, 0x07),//BOOSTER_SOFT_START
+    EPD_COMMAND(0x04),//POWER_ON
+    EPD_WAIT_IDLE,
 
-int EPD_1IN54B_V2_Init(void)
-{
-    EPD_Reset();
-    EPD_WaitUntilIdle_high();  
-	
-    EPD_SendCommand(0x12);  //SWRESET
-    EPD_WaitUntilIdle_high();   
+    EPD_SEND(0x00, 0xCF),//PANEL_SETTING
+    EPD_SEND(0x50, 0x37),//VCOM_AND_DATA_INTERVAL_SETTING
+    EPD_SEND(0x30, 0x39),//PLL_CONTROL
+    EPD_SEND(0x61, 0xC8, 0x00, 0xC8),//TCON_RESOLUTION
+    EPD_SEND(0x82, 0x0E),//VCM_DC_SETTING_REGISTER
 
-    EPD_Send_3(0x01, 0xc7, 0x00, 0x01); //Driver output control      
+    EPD_LUT(0x20, EPD_LUT_VCOM0), EPD_LUT(0x21, EPD_LUT_W), EPD_LUT(0x22, EPD_LUT_B),
+    EPD_LUT(0x23, EPD_LUT_G1), EPD_LUT(0x24, EPD_LUT_G2),
+    EPD_LUT(0x25, EPD_LUT_VCOM1), EPD_LUT(0x26, EPD_LUT_RED0), EPD_LUT(0x27, EPD_LUT_RED1),
 
-    EPD_Send_1(0x11, 0x01); //data entry mode       
+    EPD_COMMAND(0x10),//DATA_START_TRANSMISSION_1
+    EPD_DELAY(2),
+    EPD_END
+};
 
-    EPD_Send_2(0x44, 0x00, 0x18); //set Ram-X address start/end position   
+int EPD_Init_1in54b()
+{
+    return EPD_Run(EPD_Init_1in54b_prog);
+}
 
-    EPD_Send_4(0x45, 0xc7, 0x00, 0x00, 0x00); //set Ram-Y address start/end position          
+const byte EPD_1IN54B_V2_Init_prog[] PROGMEM = {
+    EPD_RESET,
+    EPD_WAIT_IDLE_HIGH,
 
-    EPD_Send_1(0x3C, 0x05); //BorderWavefrom
+    EPD_COMMAND(0x12),  //SWRESET
+    EPD_WAIT_IDLE_HIGH,
 
-    EPD_Send_1(0x18, 0x80); //Read built-in temperature sensor
+    EPD_SEND(0x01, 0xc7, 0x00, 0x01), //Driver output control
+    EPD_SEND(0x11, 0x01), //data entry mode
+    EPD_SEND(0x44, 0x00, 0x18), //set Ram-X address start/end position
+    EPD_SEND(0x45, 0xc7, 0x00, 0x00, 0x00), //set Ram-Y address start/end position
+    EPD_SEND(0x3C, 0x05), //BorderWavefrom
+    EPD_SEND(0x18, 0x80), //Read built-in temperature sensor
+    EPD_SEND(0x4E, 0x00),   // set RAM x address count to 0;
+    EPD_SEND(0x4F, 0xc7, 0x00),   // set RAM y address count to 0X199;
+    EPD_WAIT_IDLE_HIGH,
 
-    EPD_Send_1(0x4E, 0x00);   // set RAM x address count to 0;
-	
-    EPD_Send_2(0x4F, 0xc7, 0x00);   // set RAM y address count to 0X199;    
+    EPD_COMMAND(0x24),
+    EPD_DELAY(2),
+    EPD_END
+};
 
-    EPD_WaitUntilIdle_high();
-	
-	EPD_SendCommand(0x24);
-    delay(2);
-	return 0;
+int EPD_1IN54B_V2_Init(void)
+{
+    return EPD_Run(EPD_1IN54B_V2_Init_prog);
 }
 
+const byte EPD_1IN54B_V2_Show_prog[] PROGMEM = {
+    //refresh
+    EPD_SEND(0x22, 0xf7), //Display Update Control
+    EPD_COMMAND(0x20),  //Activate Display Update Sequence
+    EPD_WAIT_IDLE_HIGH,
+
+    //sleep
+    EPD_SEND(0x10, 0x01), //enter deep sleep
+    EPD_DELAY(2),
+    EPD_END
+};
+
 void EPD_1IN54B_V2_Show(void)
 {
-	//refresh
-    EPD_Send_1(0x22, 0xf7); //Display Update Control
-    EPD_SendCommand(0x20);  //Activate Display Update Sequence
-    EPD_WaitUntilIdle_high();
-	
-	//sleep
-    EPD_Send_1(0x10, 0x01); //enter deep sleep
-    delay(2);
+    EPD_Run(EPD_1IN54B_V2_Show_prog);
 }
 
+const byte EPD_Init_1in54c_prog[] PROGMEM = {
+    EPD_RESET,
+    EPD_SEND(0x01, 0x07, 0x00, 0x08, 0x00),//POWER_SETTING
+    EPD_SEND(0x06, 0x17, 0x17, 0x17),//BOOSTER_SOFT_START
+    EPD_COMMAND(0x04),//POWER_ON
+    EPD_WAIT_IDLE,
+
+    //EPD_SEND(0x00, 0x0F, 0x0D),//PANEL_SETTING
+    EPD_SEND(0x50, 0xF7),//VCOM_AND_DATA_INTERVAL_SETTING
+    EPD_SEND(0x30, 0x39),//PLL_CONTROL
+    EPD_SEND(0x61, 0x98, 0x00, 0x98),//TCON_RESOLUTION
+    EPD_SEND(0x82, 0xF7),//VCM_DC_SETTING_REGISTER
+
+    EPD_LUT(0x20, EPD_LUT_VCOM0), EPD_LUT(0x21, EPD_LUT_W), EPD_LUT(0x22, EPD_LUT_B),
+    EPD_LUT(0x23, EPD_LUT_G1), EPD_LUT(0x24, EPD_LUT_G2),
+    EPD_LUT(0x25, EPD_LUT_VCOM1), EPD_LUT(0x26, EPD_LUT_RED0), EPD_LUT(0x27, EPD_LUT_RED1),
+
+    EPD_COMMAND(0x10),//DATA_START_TRANSMISSION_1
+    EPD_DELAY(2),
+    EPD_END
+};
+
 int EPD_Init_1in54c()
 {
-    EPD_Reset();
-    EPD_Send_4(0x01, 0x07, 0x00, 0x08, 0x00);//POWER_SETTING
-    EPD_Send_3(0x06, 0x17, 0x17, 0x17);//BOOSTER_SOFT_START
-    EPD_SendCommand(0x04);//POWER_ON
-    EPD_WaitUntilIdle();
-
-    //EPD_Send_2(0x00, 0x0F, 0x0D);//PANEL_SETTING
-    EPD_Send_1(0x50, 0xF7);//VCOM_AND_DATA_INTERVAL_SETTING
-    EPD_Send_1(0x30, 0x39);//PLL_CONTROL
-    EPD_Send_3(0x61, 0x98, 0x00, 0x98);//TCON_RESOLUTION
-    EPD_Send_1(0x82, 0xF7);//VCM_DC_SETTING_REGISTER
-
-    EPD_SetLutBw (&lut_vcom0[0], &lut_w[0], &lut_b[0], &lut_g1[0], &lut_g2[0]);
-    EPD_SetLutRed(&lut_vcom1[0], &lut_red0[0], &lut_red1[0]);
-
-    EPD_SendCommand(0x10);//DATA_START_TRANSMISSION_1
-    delay(2);
-    return 0;
+    return EPD_Run(EPD_Init_1in54c_prog);
 }
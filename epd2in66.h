@@ -38,13 +38,16 @@ parameter:
 ******************************************************************************/
 static void EPD_2IN66_ReadBusy(void)
 {
-    Serial.print("e-Paper busy\r\n");
+    PROFILE_ZONE(PROFILE_BUSY);
+    unsigned long busyStart = millis();
+    LOG_D("e-Paper busy");
     delay(100);
     while(digitalRead(BUSY_PIN) == 1) {      //LOW: idle, HIGH: busy
-        delay(100);
+        schedulerDelay(100);
     }
     delay(100);
-    Serial.print("e-Paper busy release\r\n");
+    LOG_D("e-Paper busy release");
+    EPD_busyMillis += millis() - busyStart;
 }
 
 
@@ -56,7 +59,7 @@ static void EPD_2IN66_Show(void)
 {
     EPD_SendCommand(0x20);
     EPD_2IN66_ReadBusy();
-	Serial.print("EPD_2IN66_Show END\r\n");
+	LOG_I("EPD_2IN66_Show END");
 	
 	EPD_SendCommand(0x10);//sleep
     EPD_SendData(0x01); 
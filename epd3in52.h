@@ -30,7 +30,7 @@
 ******************************************************************************/
 
 //GC 0.9S
-static const UBYTE EPD_3IN52_lut_R20_GC[] =
+static const UBYTE EPD_3IN52_lut_R20_GC[] PROGMEM =
 {
   0x01,0x0f,0x0f,0x0f,0x01,0x01,0x01,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -41,7 +41,7 @@ static const UBYTE EPD_3IN52_lut_R20_GC[] =
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00
 };							  
-static const UBYTE EPD_3IN52_lut_R21_GC[] =
+static const UBYTE EPD_3IN52_lut_R21_GC[] PROGMEM =
 {
   0x01,0x4f,0x8f,0x0f,0x01,0x01,0x01,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -50,7 +50,7 @@ static const UBYTE EPD_3IN52_lut_R21_GC[] =
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00
 };						 
-static const UBYTE EPD_3IN52_lut_R22_GC[] =
+static const UBYTE EPD_3IN52_lut_R22_GC[] PROGMEM =
 {
   0x01,0x0f,0x8f,0x0f,0x01,0x01,0x01,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -61,7 +61,7 @@ static const UBYTE EPD_3IN52_lut_R22_GC[] =
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00
 };
-static const UBYTE EPD_3IN52_lut_R23_GC[] =
+static const UBYTE EPD_3IN52_lut_R23_GC[] PROGMEM =
 {
   0x01,0x4f,0x8f,0x4f,0x01,0x01,0x01,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -72,7 +72,7 @@ static const UBYTE EPD_3IN52_lut_R23_GC[] =
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00
 };
-static const UBYTE EPD_3IN52_lut_R24_GC[] =
+static const UBYTE EPD_3IN52_lut_R24_GC[] PROGMEM =
 {
   0x01,0x0f,0x8f,0x4f,0x01,0x01,0x01,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -90,14 +90,17 @@ parameter:
 ******************************************************************************/
 void EPD_3IN52_ReadBusy(void)
 {
-    Serial.print("e-Paper busy\r\n");
+    PROFILE_ZONE(PROFILE_BUSY);
+    unsigned long busyStart = millis();
+    LOG_D("e-Paper busy");
     UBYTE busy;
     do {
         busy = digitalRead(BUSY_PIN);
-        delay(20);
+        schedulerDelay(20);
     } while(!busy);
     delay(200);
-    Serial.print("e-Paper busy release\r\n");
+    LOG_D("e-Paper busy release");
+    EPD_busyMillis += millis() - busyStart;
 }
 
 /**
@@ -112,60 +115,24 @@ void EPD_3IN52_refresh(void)
     delay(200);
 }
 
-// LUT download
+// LUT download, the bw and wb luts swap on every refresh
 void EPD_3IN52_lut_GC(void)
 {
-    UBYTE count;
-    EPD_SendCommand(0x20);        // vcom
-    for(count = 0; count < 56 ; count++)
-    {
-        EPD_SendData(EPD_3IN52_lut_R20_GC[count]);
-    }
-        
-    EPD_SendCommand(0x21);        // red not use
-    for(count = 0; count < 42 ; count++)
-    {
-        EPD_SendData(EPD_3IN52_lut_R21_GC[count]);
-    }
-        
-    EPD_SendCommand(0x24);        // bb b
-    for(count = 0; count < 42 ; count++)
-    {
-        EPD_SendData(EPD_3IN52_lut_R24_GC[count]);
-    }
-    
+    EPD_lut(0x20, 56, EPD_3IN52_lut_R20_GC);  // vcom
+    EPD_lut(0x21, 42, EPD_3IN52_lut_R21_GC);  // red not use
+    EPD_lut(0x24, 42, EPD_3IN52_lut_R24_GC);  // bb b
+
     if(EPD_3IN52_Flag == 0)
     {
-        EPD_SendCommand(0x22);    // bw r
-        for(count = 0; count < 56 ; count++)
-        {
-            EPD_SendData(EPD_3IN52_lut_R22_GC[count]);
-        }
-            
-        EPD_SendCommand(0x23);    // wb w
-        for(count = 0; count < 42 ; count++)
-        {
-            EPD_SendData(EPD_3IN52_lut_R23_GC[count]);
-        }
-            
+        EPD_lut(0x22, 56, EPD_3IN52_lut_R22_GC);  // bw r
+        EPD_lut(0x23, 42, EPD_3IN52_lut_R23_GC);  // wb w
         EPD_3IN52_Flag = 1;
     }
-        
     else
     {
-        EPD_SendCommand(0x22);    // bw r
-        for(count = 0; count < 56 ; count++)
-        {
-            EPD_SendData(EPD_3IN52_lut_R23_GC[count]);
-        }
-            
-        EPD_SendCommand(0x23);    // wb w
-        for(count = 0; count < 42 ; count++)
-        {
-            EPD_SendData(EPD_3IN52_lut_R22_GC[count]);
-        }
-            
-       EPD_3IN52_Flag = 0;
+        EPD_lut(0x22, 56, EPD_3IN52_lut_R23_GC);  // bw r
+        EPD_lut(0x23, 42, EPD_3IN52_lut_R22_GC);  // wb w
+        EPD_3IN52_Flag = 0;
     }
 }
 
@@ -241,7 +208,7 @@ void EPD_3IN52_Show(void)
     EPD_3IN52_lut_GC();
     EPD_3IN52_refresh();
     delay(2);
-    Serial.print("EPD_3IN52_Show END\r\n");
+    LOG_I("EPD_3IN52_Show END");
     EPD_SendCommand(0X07);  	//deep sleep
     EPD_SendData(0xA5);
 }
@@ -29,7 +29,7 @@
 #
 ******************************************************************************/
 
-static const UBYTE lut_1Gray_GC[] =
+static const UBYTE lut_1Gray_GC[] PROGMEM =
 {
 0x2A,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//1
 0x05,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//2
@@ -46,13 +46,16 @@ static const UBYTE lut_1Gray_GC[] =
 
 static void EPD_3IN7_ReadBusy_HIGH(void)
 {
-    Serial.print("e-Paper busy\r\n");
+    PROFILE_ZONE(PROFILE_BUSY);
+    unsigned long busyStart = millis();
+    LOG_D("e-Paper busy");
     UBYTE busy;
     do {
         busy = digitalRead(BUSY_PIN);
-		delay(100);
+		schedulerDelay(100);
     } while(busy);
-    Serial.print("e-Paper busy release\r\n");
+    LOG_D("e-Paper busy release");
+    EPD_busyMillis += millis() - busyStart;
 }
 
 /******************************************************************************
@@ -61,12 +64,7 @@ parameter:
 ******************************************************************************/
 static void EPD_3IN7_Load_LUT(void)
 {
-  UWORD i;
-  EPD_SendCommand(0x32);
-  for (i = 0; i < 105; i++)
-  {
-	EPD_SendData(lut_1Gray_GC[i]);
-  }
+  EPD_lut(0x32, 105, lut_1Gray_GC);
 }
 
 /******************************************************************************
@@ -167,7 +165,7 @@ static void EPD_3IN7_1Gray_Show(void)
 	EPD_3IN7_Load_LUT();
 	EPD_SendCommand(0x20);
 	EPD_3IN7_ReadBusy_HIGH();  
-	Serial.print("EPD_3IN7_Show END\r\n");
+	LOG_I("EPD_3IN7_Show END");
 	
 	EPD_SendCommand(0X10);   //deep sleep
 	EPD_SendData(0x03);
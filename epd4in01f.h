@@ -15,18 +15,24 @@
 
 static void EPD_4IN01F_BusyHigh(void)// If BUSYN=0 then waiting
 {
-	Serial.print("\r\ne-Paper busy\r\n");
+	PROFILE_ZONE(PROFILE_BUSY);
+	unsigned long busyStart = millis();
+	LOG_D("e-Paper busy");
     while(!(digitalRead(BUSY_PIN)))
-		delay(50);
-	Serial.print("e-Paper busy release\r\n");
+		schedulerDelay(50);
+	LOG_D("e-Paper busy release");
+	EPD_busyMillis += millis() - busyStart;
 }
 
 static void EPD_4IN01F_BusyLow(void)// If BUSYN=1 then waiting
 {
-	Serial.print("\r\ne-Paper busy\r\n");
+	PROFILE_ZONE(PROFILE_BUSY);
+	unsigned long busyStart = millis();
+	LOG_D("e-Paper busy");
     while(digitalRead(BUSY_PIN))
-		delay(50);
-	Serial.print("e-Paper busy release\r\n");
+		schedulerDelay(50);
+	LOG_D("e-Paper busy release");
+	EPD_busyMillis += millis() - busyStart;
 }
 
 static void EPD_4IN01F_Show(void)
@@ -38,7 +44,7 @@ static void EPD_4IN01F_Show(void)
     EPD_SendCommand(0x02);//0x02
     EPD_4IN01F_BusyLow();
 	delay(200);
-    Serial.print("EPD_4IN01F_Show END\r\n");
+    LOG_I("EPD_4IN01F_Show END");
 
     delay(100);     
     EPD_SendCommand(0x07);//sleep
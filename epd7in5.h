@@ -9,25 +9,29 @@
   ******************************************************************************
   */
 
+const byte EPD_7in5__init_prog[] PROGMEM = {
+  EPD_RESET,
+  EPD_SEND(0x01, 0x37, 0x00),               //POWER_SETTING
+  EPD_SEND(0x00, 0xCF, 0x08),               //PANEL_SETTING
+  EPD_SEND(0x06, 0xC7, 0xCC, 0x28),         //BOOSTER_SOFT_START
+  EPD_COMMAND(0x4),                         //POWER_ON
+  EPD_WAIT_IDLE,
+  EPD_SEND(0x30, 0x3C),                     //PLL_CONTROL
+  EPD_SEND(0x41, 0x00),                     //TEMPERATURE_CALIBRATION
+  EPD_SEND(0x50, 0x77),                     //VCOM_AND_DATA_INTERVAL_SETTING
+  EPD_SEND(0x60, 0x22),                     //TCON_SETTING
+  EPD_SEND(0x61, 0x02, 0x80, 0x01, 0x80),   //TCON_RESOLUTION
+  EPD_SEND(0x82, 0x1E),                     //VCM_DC_SETTING: decide by LUT file
+  EPD_SEND(0xE5, 0x03),                     //FLASH MODE
+
+  EPD_COMMAND(0x10), //DATA_START_TRANSMISSION_1
+  EPD_DELAY(2),
+  EPD_END
+};
+
 int EPD_7in5__init()
 {
-  EPD_Reset();
-  EPD_Send_2(0x01, 0x37, 0x00);       //POWER_SETTING
-  EPD_Send_2(0x00, 0xCF, 0x08);       //PANEL_SETTING
-  EPD_Send_3(0x06, 0xC7, 0xCC, 0x28); //BOOSTER_SOFT_START
-  EPD_SendCommand(0x4);               //POWER_ON
-  EPD_WaitUntilIdle();
-  EPD_Send_1(0x30, 0x3C);                   //PLL_CONTROL
-  EPD_Send_1(0x41, 0x00);                   //TEMPERATURE_CALIBRATION
-  EPD_Send_1(0x50, 0x77);                   //VCOM_AND_DATA_INTERVAL_SETTING
-  EPD_Send_1(0x60, 0x22);                   //TCON_SETTING
-  EPD_Send_4(0x61, 0x02, 0x80, 0x01, 0x80); //TCON_RESOLUTION
-  EPD_Send_1(0x82, 0x1E);                   //VCM_DC_SETTING: decide by LUT file
-  EPD_Send_1(0xE5, 0x03);                   //FLASH MODE
-
-  EPD_SendCommand(0x10); //DATA_START_TRANSMISSION_1
-  delay(2);
-  return 0;
+  return EPD_Run(EPD_7in5__init_prog);
 }
 
 /*****************************************************************************
@@ -35,12 +39,15 @@ int EPD_7in5__init()
 ******************************************************************************/
 static void EPD_7in5_V2_Readbusy(void)
 {
-  Serial.print("\r\ne-Paper busy\r\n");
+  PROFILE_ZONE(PROFILE_BUSY);
+  unsigned long busyStart = millis();
+  LOG_D("e-Paper busy");
   do{
-    delay(20);
+    schedulerDelay(20);
   }while(!(digitalRead(BUSY_PIN)));
   delay(20);
-  Serial.print("e-Paper busy release\r\n");
+  LOG_D("e-Paper busy release");
+  EPD_busyMillis += millis() - busyStart;
 }
 
 static void EPD_7IN5_V2_Show(void)
@@ -135,19 +142,8 @@ int EPD_7in5B_V2_Init(void)
 	EPD_SendData(0x00);//800*480
 	EPD_SendData(0x00);
 	EPD_SendData(0x00);
-	
-  UWORD i;
-  EPD_SendCommand(0x10);
-  for (i = 0; i < 800 / 8 * 480; i++)
-  {
-    EPD_SendData(0x00);
-  }
-  EPD_SendCommand(0x13);
-  for (i = 0; i < 800 / 8 * 480; i++)
-  {
-    EPD_SendData(0x00);
-  }
 
+  // No clearing of both planes here, the upload writes both of them completely
   EPD_SendCommand(0x10);
   return 0;
 }
@@ -12,15 +12,18 @@
 
 void EPD_7IN5_HD_Readbusy(void)
 {
-    Serial.print("\r\ne-Paper busy\r\n");
+    PROFILE_ZONE(PROFILE_BUSY);
+    unsigned long busyStart = millis();
+    LOG_D("e-Paper busy");
     delay(200);
     unsigned char busy;
     do{
-		delay(100);
+		schedulerDelay(100);
         busy = digitalRead(BUSY_PIN);     
     }while(busy);
     delay(200);
-    Serial.print("e-Paper busy release\r\n");
+    LOG_D("e-Paper busy release");
+    EPD_busyMillis += millis() - busyStart;
 }
 
 
@@ -29,18 +32,14 @@ void EPD_7IN5_HD_Readbusy(void)
 ******************************************************************************/
 
 static void EPD_7IN5_HD_Show(void)
-{   
-	unsigned int i;
-	EPD_SendCommand(0x26);
-    for(i=0; i<880*528/8; i++)	{
-        EPD_SendData(0xff);
-    }
+{
+    // The red RAM (0x26) is still filled by Auto Write RAM of EPD_7IN5_HD_init()
     EPD_SendCommand(0x22);
     EPD_SendData(0xF7);
     EPD_SendCommand(0x20);
     delay(200);
     EPD_7IN5_HD_Readbusy();
-    Serial.print("EPD_7IN5_HD_Show END\r\n");
+    LOG_I("EPD_7IN5_HD_Show END");
 }
 
 int EPD_7IN5_HD_init() 
@@ -120,7 +119,7 @@ static void EPD_7IN5B_HD_Show(void)
     EPD_SendCommand(0x20);
     delay(200);
     EPD_7IN5_HD_Readbusy();
-    Serial.print("EPD_7IN5B_HD_Show END\r\n");
+    LOG_I("EPD_7IN5B_HD_Show END");
 }
 
 int EPD_7IN5B_HD_init() 
@@ -8,69 +8,96 @@
   *
   ******************************************************************************
   */
+#include "webui.h"   // gzip compressed page, styles and script, see web/bundle.sh
+
 extern  ESP8266WebServer server;
-extern  IPAddress myIP;      
+extern  IPAddress myIP;
+
+/* Chunked response through a small buffer instead of a heap String --------*/
+class ResponsePrint : public Print
+{
+public:
+    ResponsePrint(int code, const char *type) : length(0)
+    {
+        server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+        server.send(code, type, "");
+    }
+
+    ~ResponsePrint()
+    {
+        sendBuffer();
+        server.sendContent("");
+        metricsHeap();
+    }
+
+    size_t write(uint8_t c) override
+    {
+        buffer[length++] = c;
+        if (length == sizeof buffer)
+            sendBuffer();
+        return 1;
+    }
+
+private:
+    void sendBuffer()
+    {
+        if (length > 0)
+            server.sendContent(buffer, length);
+        length = 0;
+    }
+
+    char buffer[256];
+    size_t length;
+};
+
+/* Sending a gzip compressed asset from flash, 304 if the browser has it ----*/
+void sendAsset(const char *type, const uint8_t *data, size_t length, const char *etag, const char *cacheControl)
+{
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", cacheControl);
+    if (server.header("If-None-Match") == etag)
+    {
+        server.send(304);
+        return;
+    }
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, type, (PGM_P)data, length);
+    metricsHeap();
+}
 
+/* The page is revalidated, styles and script are referenced by version -----*/
 void handleRoot()
 {
-server.send(200, "text/html", 
-"<!DOCTYPE html>\r\n"
-"<html>\r\n"
-"<head>\r\n"
-"<link rel='icon' href='data:;base64,='>\r\n"
-"<meta charset='utf-8'>\r\n"
-"<title>PriceTag</title>\r\n"
-"<link rel='stylesheet' href='styles.css'>\r\n"
-"<script src='processingA.js'></script>\r\n"
-"<script src='processingB.js'></script>\r\n"
-"<script src='processingC.js'></script>\r\n"
-"<script src='processingD.js'></script>\r\n"
-"</head>\r\n"
-"<body>\r\n"
-"<div class='header_back'>\r\n"
-"<div class='header_face'></div>\r\n"
-"</div>\r\n"
-"<div class='content_back'>\r\n"
-"<div class='content_face'>\r\n"
-"<table style='width:100%; height:100%' border='0' cellspacing='0'>\r\n"
-"<tr>\r\n"
-"<td class='menu_bar' rowspan='2'>\r\n"
-"<div id='BT'></div>\r\n"
-"<table>\r\n"
-"<tr>\r\n"
-"<td class='comment' colspan='4'><br>Device IP:</td>\r\n"
-"</tr>\r\n"               
-"<tr>\r\n"
-"<td colspan=\"4\"><input id=\"ip_addr\" style=\"width:100%;text-align:center\" type=\"text\" value=\"\r\n"
-+ String(myIP[0],DEC)+'.'+String(myIP[1],DEC)+'.'+String(myIP[2],DEC)+'.'+String(myIP[3],DEC)+"\"></td>\r\n"
-"</tr>\r\n"               
-"<tr><td class='comment' colspan='4'><br>Bounds:</td></tr>\r\n" 
-"<tr id='XY'></tr>\r\n"
-"<tr id='WH'></tr>\r\n"
-"</table>\r\n"       
-"<div id='RB'></div>\r\n"
-"</td>\r\n"
-"<td class='content_body'>\r\n"
-"<span class='title'>Original image</span><br>\r\n"
-"<canvas id='source' class='hidden_input'></canvas>\r\n"        
-"<div id='srcBox'>\r\n"
-"<div class='imgBox'>\r\n"
-"<div class='mesBox'>Drop image here...</div>\r\n"
-"</div>\r\n"
-"</div>\r\n"            
-"</td>\r\n"      
-"</tr>\r\n"
-"<tr>\r\n"
-"<td id='dstBox' class='content_body'>\r\n" 
-"</td>\r\n"        
-"</tr>\r\n"
-"</table>\r\n"
-"</div>\r\n"
-"</div>\r\n"
-"<div class='footer_back'>\r\n"
-"<div class='footer_face' id='logTag'>\r\n"
-"</div>\r\n"
-"</div>\r\n"
-"</body>\r\n"
-"</html>\r\n");
+    sendAsset("text/html", WEB_HTML, sizeof WEB_HTML, WEB_HTML_ETAG, "no-cache");
+}
+
+void sendCSS()
+{
+    sendAsset("text/css", WEB_CSS, sizeof WEB_CSS, WEB_CSS_ETAG, "max-age=31536000, immutable");
+}
+
+void sendJS()
+{
+    sendAsset("text/javascript", WEB_JS, sizeof WEB_JS, WEB_JS_ETAG, "max-age=31536000, immutable");
+}
+
+/* Settings of this device: IP address, resolution, palette, upload mode ----*/
+/* and title of the e-Papers                                                  */
+void sendConfigJS()
+{
+    server.sendHeader("Cache-Control", "no-store");
+    ResponsePrint response(200, "text/javascript");
+
+    response.printf("var cfgIP='%u.%u.%u.%u';\r\nvar epdPanels=%d;\r\nvar epdArr=[\r\n",
+            myIP[0], myIP[1], myIP[2], myIP[3], EPD_PANELS);
+    for (int i = 0; i < EPD_dispCount; i++)
+    {
+        response.printf("[%d,%d,%d,%d]%s\r\n", EPD_dispMass[i].width, EPD_dispMass[i].height,
+                EPD_dispMass[i].palette, EPD_uploadMode(i), i < EPD_dispCount - 1 ? "," : "];");
+    }
+    response.print("var epdNam=[\r\n");
+    for (int i = 0; i < EPD_dispCount; i++)
+    {
+        response.printf("'%s'%s\r\n", EPD_isAvailable(i) ? EPD_dispMass[i].title : "", i < EPD_dispCount - 1 ? "," : "];");
+    }
 }
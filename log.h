@@ -0,0 +1,114 @@
+/**
+ * Log with compile-time levels and a RAM ring buffer, served at /log.
+ *
+ * LOG_E/W/I/D(format, ...) above LOG_LEVEL compile to nothing. The others only
+ * store the format pointer and up to LOG_ARGS 32 bit arguments, formatting is
+ * deferred until the log is read with logPrint() or published with
+ * logPublish(). So %s arguments must outlive the entry (literals, panel
+ * titles), %f is not supported. Build with -DLOG_SERIAL=1 to echo every
+ * entry to Serial right away.
+ */
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+#ifndef LOG_SERIAL
+#define LOG_SERIAL 0
+#endif
+
+const int LOG_ENTRIES = 32;
+const int LOG_ARGS = 3;
+const char LOG_LETTERS[] = "-EWID";
+
+struct LogEntry {
+	uint32_t millis;
+	const char *format;
+	uint32_t args[LOG_ARGS];
+	uint8_t level;
+};
+
+LogEntry logRing[LOG_ENTRIES];
+uint16_t logHead;  // next entry to write
+uint16_t logCount; // valid entries
+uint32_t logLost;  // entries overwritten before they were read
+
+// -----------------------------------------------------------------------------------------------------
+int logFormat(const LogEntry &entry, char *text, int size) {
+	int length = snprintf(text, size, "%lu %c ", (unsigned long) entry.millis, LOG_LETTERS[entry.level]);
+	if (length < size) {
+		length += snprintf(text + length, size - length, entry.format, entry.args[0], entry.args[1], entry.args[2]);
+	}
+	return length < size ? length : size - 1;
+}
+
+// -----------------------------------------------------------------------------------------------------
+template <typename... Args>
+void logWrite(uint8_t level, const char *format, Args... args) {
+	static_assert(sizeof...(args) <= LOG_ARGS, "too many log arguments");
+	uint32_t values[LOG_ARGS + 1] = { (uint32_t) (uintptr_t) args... };
+
+	LogEntry &entry = logRing[logHead];
+	entry.millis = millis();
+	entry.format = format;
+	memcpy(entry.args, values, sizeof entry.args);
+	entry.level = level;
+	logHead = (logHead + 1) % LOG_ENTRIES;
+	if (logCount < LOG_ENTRIES) {
+		logCount++;
+	} else {
+		logLost++;
+	}
+#if LOG_SERIAL
+	char text[128];
+	logFormat(entry, text, sizeof text);
+	Serial.println(text);
+#endif
+}
+
+// -----------------------------------------------------------------------------------------------------
+void logPrint(Print &out) {
+	if (logLost > 0) {
+		out.printf("(%u entries lost)\r\n", (unsigned) logLost);
+	}
+	char text[128];
+	for (int i = 0; i < logCount; ++i) {
+		logFormat(logRing[(logHead + LOG_ENTRIES - logCount + i) % LOG_ENTRIES], text, sizeof text);
+		out.printf("%s\r\n", text);
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void logPublish(PubSubClient &client, const char *topic) {
+	char text[128];
+	for (; logCount > 0 && client.connected(); --logCount) {
+		logFormat(logRing[(logHead + LOG_ENTRIES - logCount) % LOG_ENTRIES], text, sizeof text);
+		client.publish(topic, text);
+	}
+}
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(...) logWrite(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_E(...)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(...) logWrite(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_W(...)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(...) logWrite(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_I(...)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(...) logWrite(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_D(...)
+#endif
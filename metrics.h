@@ -0,0 +1,190 @@
+/**
+ * Prometheus text format metrics of the web server, served at /metrics.
+ *
+ * All values are static counters updated by the request handlers, scraping
+ * formats them into a small stack buffer and sends it in chunks, so it is
+ * cheap enough to be done while an upload is running.
+ */
+
+enum MetricsRequest {
+	METRICS_EPD,
+	METRICS_LOAD,
+	METRICS_NEXT,
+	METRICS_SHOW,
+	METRICS_REQUESTS
+};
+
+const char *METRICS_REQUEST_NAMES[METRICS_REQUESTS] = { "EPD", "LOAD", "NEXT", "SHOW" };
+
+// upper bounds of the latency histogram buckets in milliseconds, the last bucket is +Inf
+const uint16_t METRICS_BUCKETS[] = { 5, 10, 25, 50, 100, 250, 500, 1000, 2500, 10000 };
+const int METRICS_BUCKET_COUNT = sizeof METRICS_BUCKETS / sizeof METRICS_BUCKETS[0];
+
+uint32_t metricsBuckets[METRICS_REQUESTS][METRICS_BUCKET_COUNT + 1];
+uint32_t metricsRequestMillis[METRICS_REQUESTS];
+uint32_t metricsLoadBytes;     // characters received by accepted /LOAD requests
+uint32_t metricsLoadRejected;  // /LOAD requests with a wrong length, the client resends them
+uint64_t metricsLoadCycles;    // CPU cycles (at CPU_BASE_MHZ) spent in the loading functions (decode and SPI)
+uint64_t metricsLoadSpiCycles; // the part of them spent in SPI transfers
+uint32_t metricsBusyMillis[EPD_dispCount];
+
+// load time per panel type, loader and clock, to compare each loader at 80 and 160 MHz; a slot is free
+// as long as no bytes are counted in it, loads beyond the last slot only go into the totals
+const int METRICS_LOADERS = 8;
+
+struct MetricsLoader {
+	int16_t index;  // panel type
+	uint8_t loader; // 0 black channel (or both, if the red one has the same loader), 1 red channel, 2 both planes
+	uint8_t mhz;
+	uint32_t bytes;
+	uint64_t cycles;
+};
+
+MetricsLoader metricsLoaders[METRICS_LOADERS];
+const char *METRICS_LOADER_NAMES[] = { "black", "red", "planes" };
+uint32_t metricsHeapLow = UINT32_MAX;  // lowest free heap at the end of a request
+uint32_t metricsBlockLow = UINT32_MAX; // lowest largest free block at the end of a request
+
+// -----------------------------------------------------------------------------------------------------
+void metricsHeap() {
+	uint32_t heap = ESP.getFreeHeap();
+	uint32_t block = ESP.getMaxFreeBlockSize();
+	if (heap < metricsHeapLow) {
+		metricsHeapLow = heap;
+	}
+	if (block < metricsBlockLow) {
+		metricsBlockLow = block;
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void metricsBusy() {
+	// busy waits are collected per request or refresh and accounted to the current e-Paper
+	metricsBusyMillis[EPD_dispIndex] += EPD_busyMillis;
+	EPD_busyMillis = 0;
+}
+
+// -----------------------------------------------------------------------------------------------------
+void metricsRequest(MetricsRequest request, unsigned long startMillis) {
+	uint32_t duration = millis() - startMillis;
+	int bucket = 0;
+	while (bucket < METRICS_BUCKET_COUNT && duration > METRICS_BUCKETS[bucket]) {
+		bucket++;
+	}
+	metricsBuckets[request][bucket]++;
+	metricsRequestMillis[request] += duration;
+
+	metricsHeap();
+	metricsBusy();
+}
+
+// -----------------------------------------------------------------------------------------------------
+void metricsLoad(int length, uint32_t startCycle, uint64_t startSpiCycles) {
+	uint32_t cycles = cpuBaseCycles() - startCycle;
+	metricsLoadBytes += length;
+	metricsLoadCycles += cycles;
+	metricsLoadSpiCycles += EPD_spiCycles - startSpiCycles;
+
+	uint8_t loader = EPD_dispPlanes ? 2 : EPD_dispLoad == EPD_dispMass[EPD_dispIndex].chBk ? 0 : 1;
+	uint8_t mhz = ESP.getCpuFreqMHz();
+	for (int slot = 0; slot < METRICS_LOADERS; ++slot) {
+		MetricsLoader &entry = metricsLoaders[slot];
+		if (entry.bytes == 0) {
+			entry.index = EPD_dispIndex;
+			entry.loader = loader;
+			entry.mhz = mhz;
+		} else if (entry.index != EPD_dispIndex || entry.loader != loader || entry.mhz != mhz) {
+			continue;
+		}
+		entry.bytes += length;
+		entry.cycles += cycles;
+		return;
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void metricsPrintf(char *buffer, int &length, int size, const char *format, ...) {
+	// flush the buffer before it might overflow, a single line is always shorter than 128 characters
+	if (length > size - 128) {
+		server.sendContent(buffer, length);
+		length = 0;
+	}
+	va_list args;
+	va_start(args, format);
+	length += vsnprintf(buffer + length, size - length, format, args);
+	va_end(args);
+}
+
+// -----------------------------------------------------------------------------------------------------
+void sendMetrics() {
+	char buffer[512];
+	int length = 0;
+	const int size = sizeof buffer;
+	float cyclesPerSecond = CPU_BASE_MHZ * 1000000.0;
+
+	server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+	server.send(200, "text/plain; version=0.0.4", "");
+
+	metricsPrintf(buffer, length, size, "# TYPE espeink_heap_free_bytes gauge\nespeink_heap_free_bytes %u\n", (unsigned) ESP.getFreeHeap());
+	metricsPrintf(buffer, length, size, "# TYPE espeink_heap_max_block_bytes gauge\nespeink_heap_max_block_bytes %u\n", (unsigned) ESP.getMaxFreeBlockSize());
+	metricsPrintf(buffer, length, size, "# TYPE espeink_heap_free_low_bytes gauge\nespeink_heap_free_low_bytes %u\n", (unsigned) metricsHeapLow);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_heap_max_block_low_bytes gauge\nespeink_heap_max_block_low_bytes %u\n", (unsigned) metricsBlockLow);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_arena_peak_bytes gauge\nespeink_arena_peak_bytes %u\n", (unsigned) arenaPeak);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_arena_truncated_total counter\nespeink_arena_truncated_total %u\n", (unsigned) arenaTruncated);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_heap_fragmentation_percent gauge\nespeink_heap_fragmentation_percent %u\n", (unsigned) ESP.getHeapFragmentation());
+
+	metricsPrintf(buffer, length, size, "# TYPE espeink_cpu_mhz gauge\nespeink_cpu_mhz %u\n", (unsigned) ESP.getCpuFreqMHz());
+	metricsPrintf(buffer, length, size, "# TYPE espeink_battery_millivolts gauge\nespeink_battery_millivolts %u\n", (unsigned) powerBatteryMv);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_sleep_multiplier gauge\nespeink_sleep_multiplier %u\n", (unsigned) powerState.multiplier);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_load_received_bytes_total counter\nespeink_load_received_bytes_total %u\n", (unsigned) metricsLoadBytes);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_load_rejected_total counter\nespeink_load_rejected_total %u\n", (unsigned) metricsLoadRejected);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_load_seconds_total counter\nespeink_load_seconds_total %.3f\n", metricsLoadCycles / cyclesPerSecond);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_spi_bytes_total counter\nespeink_spi_bytes_total %u\n", (unsigned) EPD_spiBytes);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_spi_seconds_total counter\nespeink_spi_seconds_total %.3f\n", EPD_spiCycles / cyclesPerSecond);
+
+	// throughput of the loading functions without their own SPI transfers, and of all SPI transfers
+	// (init, lut and show included) alone
+	float decodeSeconds = (metricsLoadCycles - metricsLoadSpiCycles) / cyclesPerSecond;
+	float spiSeconds = EPD_spiCycles / cyclesPerSecond;
+	metricsPrintf(buffer, length, size, "# TYPE espeink_decode_bytes_per_second gauge\nespeink_decode_bytes_per_second %.0f\n", decodeSeconds > 0 ? metricsLoadBytes / decodeSeconds : 0);
+	metricsPrintf(buffer, length, size, "# TYPE espeink_spi_bytes_per_second gauge\nespeink_spi_bytes_per_second %.0f\n", spiSeconds > 0 ? EPD_spiBytes / spiSeconds : 0);
+
+	metricsPrintf(buffer, length, size, "# TYPE espeink_loader_bytes_total counter\n");
+	for (int slot = 0; slot < METRICS_LOADERS && metricsLoaders[slot].bytes > 0; ++slot) {
+		const MetricsLoader &entry = metricsLoaders[slot];
+		metricsPrintf(buffer, length, size, "espeink_loader_bytes_total{title=\"%s\",loader=\"%s\",mhz=\"%u\"} %u\n",
+				EPD_dispMass[entry.index].title, METRICS_LOADER_NAMES[entry.loader], (unsigned) entry.mhz, (unsigned) entry.bytes);
+	}
+	metricsPrintf(buffer, length, size, "# TYPE espeink_loader_seconds_total counter\n");
+	for (int slot = 0; slot < METRICS_LOADERS && metricsLoaders[slot].bytes > 0; ++slot) {
+		const MetricsLoader &entry = metricsLoaders[slot];
+		metricsPrintf(buffer, length, size, "espeink_loader_seconds_total{title=\"%s\",loader=\"%s\",mhz=\"%u\"} %.3f\n",
+				EPD_dispMass[entry.index].title, METRICS_LOADER_NAMES[entry.loader], (unsigned) entry.mhz, entry.cycles / cyclesPerSecond);
+	}
+
+	metricsPrintf(buffer, length, size, "# TYPE espeink_busy_seconds_total counter\n");
+	for (int index = 0; index < EPD_dispCount; ++index) {
+		if (metricsBusyMillis[index] > 0) {
+			metricsPrintf(buffer, length, size, "espeink_busy_seconds_total{panel=\"%d\",title=\"%s\"} %.3f\n",
+					index, EPD_dispMass[index].title, metricsBusyMillis[index] / 1000.0);
+		}
+	}
+
+	metricsPrintf(buffer, length, size, "# TYPE espeink_request_duration_seconds histogram\n");
+	for (int request = 0; request < METRICS_REQUESTS; ++request) {
+		const char *name = METRICS_REQUEST_NAMES[request];
+		uint32_t count = 0;
+		for (int bucket = 0; bucket < METRICS_BUCKET_COUNT; ++bucket) {
+			count += metricsBuckets[request][bucket];
+			metricsPrintf(buffer, length, size, "espeink_request_duration_seconds_bucket{path=\"%s\",le=\"%.3f\"} %u\n",
+					name, METRICS_BUCKETS[bucket] / 1000.0, (unsigned) count);
+		}
+		count += metricsBuckets[request][METRICS_BUCKET_COUNT];
+		metricsPrintf(buffer, length, size, "espeink_request_duration_seconds_bucket{path=\"%s\",le=\"+Inf\"} %u\n", name, (unsigned) count);
+		metricsPrintf(buffer, length, size, "espeink_request_duration_seconds_sum{path=\"%s\"} %.3f\n", name, metricsRequestMillis[request] / 1000.0);
+		metricsPrintf(buffer, length, size, "espeink_request_duration_seconds_count{path=\"%s\"} %u\n", name, (unsigned) count);
+	}
+
+	server.sendContent(buffer, length);
+	server.sendContent("");
+}
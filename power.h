@@ -0,0 +1,73 @@
+/**
+ * Adaptive sleep interval and battery voltage.
+ *
+ * The sleep interval is a multiple of the configured sleep time kept in RTC
+ * memory: a wake that showed a new frame resets it to 1, every wake without an
+ * update doubles it up to the configured maximum (exponential backoff).
+ * With BATTERY_ADC the cell voltage is read from A0 early on every wake, below
+ * BATTERY_LOW_MV the interval is stretched up to BATTERY_STRETCH_MAX times and
+ * below BATTERY_EMPTY_MV the wake skips WiFi and the refresh altogether.
+ */
+
+#ifndef BATTERY_ADC
+#define BATTERY_ADC 0
+#endif
+#ifndef BATTERY_FULL_SCALE_MV
+#define BATTERY_FULL_SCALE_MV 4200 // voltage at ADC reading 1023, depends on the divider in front of A0
+#endif
+
+const uint16_t BATTERY_LOW_MV = 3600;
+const uint16_t BATTERY_EMPTY_MV = 3300;
+const int BATTERY_STRETCH_MAX = 4;
+const uint32_t POWER_MAGIC = 0x45505031; // "EPP1"
+const uint32_t POWER_RTC_OFFSET = CLOCK_RTC_OFFSET + (sizeof(ClockState) + 3) / 4; // right after the clock
+
+struct PowerState {
+	uint32_t magic;
+	uint32_t multiplier; // current sleep interval in sleep times
+};
+
+PowerState powerState;
+uint16_t powerBatteryMv; // 0 without BATTERY_ADC
+
+// -----------------------------------------------------------------------------------------------------
+void powerBegin(bool isDeepSleepWake) {
+	if (!isDeepSleepWake
+			|| !ESP.rtcUserMemoryRead(POWER_RTC_OFFSET, (uint32_t*) &powerState, sizeof powerState)
+			|| powerState.magic != POWER_MAGIC || powerState.multiplier == 0) {
+		powerState.magic = POWER_MAGIC;
+		powerState.multiplier = 1;
+	}
+#if BATTERY_ADC
+	// before WiFi is up, the radio disturbs the ADC
+	powerBatteryMv = (uint32_t) analogRead(A0) * BATTERY_FULL_SCALE_MV / 1023;
+	LOG_I("Battery %u mV", powerBatteryMv);
+#endif
+}
+
+// -----------------------------------------------------------------------------------------------------
+bool powerIsBatteryEmpty() {
+	return powerBatteryMv > 0 && powerBatteryMv < BATTERY_EMPTY_MV;
+}
+
+// -----------------------------------------------------------------------------------------------------
+int powerBatteryStretch() {
+	if (powerBatteryMv == 0 || powerBatteryMv >= BATTERY_LOW_MV) {
+		return 1;
+	}
+	if (powerBatteryMv <= BATTERY_EMPTY_MV) {
+		return BATTERY_STRETCH_MAX;
+	}
+	return 1 + (BATTERY_STRETCH_MAX - 1) * (BATTERY_LOW_MV - powerBatteryMv) / (BATTERY_LOW_MV - BATTERY_EMPTY_MV);
+}
+
+// -----------------------------------------------------------------------------------------------------
+uint32_t powerBackoff(bool isUpdated, uint32_t maxMultiplier) {
+	if (isUpdated) {
+		powerState.multiplier = 1;
+	} else if (powerState.multiplier < maxMultiplier) {
+		powerState.multiplier = min(powerState.multiplier * 2, maxMultiplier);
+	}
+	ESP.rtcUserMemoryWrite(POWER_RTC_OFFSET, (uint32_t*) &powerState, sizeof powerState);
+	return powerState.multiplier;
+}
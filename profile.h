@@ -0,0 +1,88 @@
+/**
+ * Scoped profiling zones of the hot paths, build with -DPROFILE_ZONES=1.
+ *
+ * PROFILE_ZONE(zone) at the top of a block measures the cycles until the
+ * block is left and accumulates calls, total, min and max in profileTable.
+ * profilePrint() dumps the table, it is printed before deep sleep and served
+ * at /profile. Without PROFILE_ZONES the macro expands to nothing.
+ */
+
+#ifndef PROFILE_ZONES
+#define PROFILE_ZONES 0
+#endif
+
+#if PROFILE_ZONES
+
+enum ProfileZone {
+	PROFILE_SPI,          // EpdSpiTransferCallback()
+	PROFILE_LUT,          // EPD_lut()
+	PROFILE_BUSY,         // busy waits of all e-Papers
+	PROFILE_LOAD_A,       // EPD_loadA(), EPD_loadAFilp()
+	PROFILE_LOAD_B,       // EPD_loadB()
+	PROFILE_LOAD_C,       // EPD_loadC()
+	PROFILE_LOAD_D,       // EPD_loadD()
+	PROFILE_LOAD_E,       // EPD_loadE()
+	PROFILE_LOAD_G,       // EPD_loadG()
+	PROFILE_LOAD_PLANES,  // EPD_loadPlanes()
+	PROFILE_LOAD_SPOOLED, // EPD_loadSpooled()
+	PROFILE_HTTP,         // server.handleClient()
+	PROFILE_MQTT,         // mqttClient.loop()
+	PROFILE_ZONE_COUNT
+};
+
+const char *PROFILE_NAMES[PROFILE_ZONE_COUNT] = { "spi", "lut", "busy", "loadA", "loadB", "loadC", "loadD",
+		"loadE", "loadG", "loadPlanes", "loadSpooled", "handleClient", "mqttLoop" };
+
+// a single call is limited to the 32 bit cycle counter, about 26 s at 160 MHz
+struct ProfileEntry {
+	uint32_t calls;
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+};
+
+ProfileEntry profileTable[PROFILE_ZONE_COUNT];
+
+class ProfileScope {
+public:
+	ProfileScope(ProfileZone zone) : zone(zone), start(cpuBaseCycles()) {
+	}
+
+	~ProfileScope() {
+		uint32_t cycles = cpuBaseCycles() - start;
+		ProfileEntry &entry = profileTable[zone];
+		if (entry.calls == 0 || cycles < entry.min) {
+			entry.min = cycles;
+		}
+		if (cycles > entry.max) {
+			entry.max = cycles;
+		}
+		entry.total += cycles;
+		entry.calls++;
+	}
+
+private:
+	ProfileZone zone;
+	uint32_t start;
+};
+
+#define PROFILE_ZONE(zone) ProfileScope profileScope(zone)
+
+// -----------------------------------------------------------------------------------------------------
+void profilePrint(Print &out) {
+	uint32_t mhz = CPU_BASE_MHZ;
+	out.printf("zone          calls    total us      min us      max us\r\n");
+	for (int zone = 0; zone < PROFILE_ZONE_COUNT; ++zone) {
+		ProfileEntry &entry = profileTable[zone];
+		if (entry.calls > 0) {
+			out.printf("%-12s %6u %11u %11u %11u\r\n", PROFILE_NAMES[zone], (unsigned) entry.calls,
+					(unsigned) (entry.total / mhz), (unsigned) (entry.min / mhz), (unsigned) (entry.max / mhz));
+		}
+	}
+}
+
+#else
+
+#define PROFILE_ZONE(zone)
+
+#endif
@@ -0,0 +1,46 @@
+/**
+ * Cooperative scheduler of the tasks in loop().
+ *
+ * Every task of schedulerTasks (defined in the sketch) runs when its interval
+ * in milliseconds has passed, 0 runs it on every pass. Busy waits of the
+ * e-Paper call schedulerDelay() instead of delay(), which keeps the WiFi stack
+ * and the background tasks (e.g. MQTT keep alive) going while the panel works.
+ * Busy waits are always between two commands to a panel, so a background task
+ * may work on another panel if it selects it with EPD_PanelScope. Background
+ * tasks may run from within a request handler and must not re-enter the web
+ * server then.
+ */
+
+struct SchedulerTask {
+	void (*run)();
+	unsigned long interval; // milliseconds between two runs, 0 for every pass
+	bool isBackground;      // also run during busy waits, see schedulerDelay()
+	unsigned long last;     // millis() of the last run
+};
+
+extern SchedulerTask schedulerTasks[];
+extern const int SCHEDULER_TASKS;
+
+// -----------------------------------------------------------------------------------------------------
+void schedulerRun(bool isBackground) {
+	unsigned long now = millis();
+	for (int i = 0; i < SCHEDULER_TASKS; ++i) {
+		SchedulerTask &task = schedulerTasks[i];
+		if ((!isBackground || task.isBackground)
+				&& (task.interval == 0 || now - task.last >= task.interval)) {
+			task.last = now;
+			task.run();
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void schedulerDelay(unsigned long milliseconds) {
+	unsigned long start = millis();
+	unsigned long elapsed;
+	while ((elapsed = millis() - start) < milliseconds) {
+		schedulerRun(true);
+		unsigned long remaining = milliseconds - elapsed;
+		delay(remaining < 10 ? remaining : 10);
+	}
+}
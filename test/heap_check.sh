@@ -0,0 +1,62 @@
+#!/bin/bash
+# Serves /, /config.js, /metrics, /log and a not found page of a device many times and checks that
+# the free heap and the largest free block are the same before and after, i.e. the handlers neither
+# leak nor fragment. With MQTT_BROKER and MQTT_TOPIC (the mqttUpdateStatusTopic of the device) set,
+# every round also publishes 'false' to the topic, which runs the MQTT callback without starting an
+# update. The device has to stay awake meanwhile, i.e. run without a sleep time.
+# A few thousand rounds make a soak test of a long non-sleeping session.
+#
+#   [MQTT_BROKER=<host> MQTT_TOPIC=<topic>] test/heap_check.sh <device ip> [rounds]
+
+HOST=$1
+ROUNDS=${2:-200}
+PATHS="/ /config.js /metrics /log /missing?arg=1"
+
+if [ -z "${HOST}" ]; then
+	echo "usage: $0 <device ip> [rounds]"
+	exit 2
+fi
+
+# free heap and largest free block as seen by a /metrics request
+heap() {
+	curl -s "http://${HOST}/metrics" | awk '
+		/^espeink_heap_free_bytes / { free = $2 }
+		/^espeink_heap_max_block_bytes / { block = $2 }
+		END { print free, block }'
+}
+
+# a settled heap: closed connections keep some memory until their TIME_WAIT is over
+settled() {
+	local last=$(heap) current
+	for attempt in 1 2 3 4 5; do
+		sleep 2
+		current=$(heap)
+		[ "${current}" == "${last}" ] && break
+		last=${current}
+	done
+	echo ${current}
+}
+
+serve() {
+	for round in $(seq ${ROUNDS}); do
+		for path in ${PATHS}; do
+			curl -s -o /dev/null "http://${HOST}${path}" || { echo "request of ${path} failed"; exit 1; }
+		done
+		if [ -n "${MQTT_BROKER}" ]; then
+			mosquitto_pub -h "${MQTT_BROKER}" -t "${MQTT_TOPIC}" -m false || { echo "publishing to ${MQTT_TOPIC} failed"; exit 1; }
+		fi
+	done
+}
+
+# one round first, so buffers the server allocates once are in place before the baseline
+ROUNDS=1 serve
+before=$(settled)
+serve
+after=$(settled)
+
+echo "free heap / largest block before: ${before}, after ${ROUNDS} rounds of ${PATHS}${MQTT_BROKER:+ and MQTT}: ${after}"
+if [ "${before}" != "${after}" ]; then
+	echo "FAILED"
+	exit 1
+fi
+echo "OK"
@@ -0,0 +1,159 @@
+/**
+ * Host benchmark of the pixel expansion of EPD_loadB(), EPD_loadD() and
+ * EPD_loadE(): the per-pixel loops of the Waveshare driver against the flash
+ * tables of epd.h (EPD_tableB/D/E, extracted by run_bench.sh).
+ *
+ * Both variants decode the same 48 KB frame from the 'a'..'p' encoding of the
+ * web client, the output must be identical. SPI is left out, the data bytes
+ * are only collected, so the timings are the CPU time of the expansion alone.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+typedef uint8_t byte;
+#define PROGMEM
+#define memcpy_P memcpy
+#include "epd_tables.h"
+
+const int FRAME_BYTES = 48 * 1024;
+const int ROUNDS = 50;
+
+std::vector<byte> sent;
+
+// -----------------------------------------------------------------------------------------------------
+void sendData(byte data) {
+	sent.push_back(data);
+}
+
+// -----------------------------------------------------------------------------------------------------
+void sendDataBlock(const byte *data, int length) {
+	sent.insert(sent.end(), data, data + length);
+}
+
+// -----------------------------------------------------------------------------------------------------
+void loopB(const std::string &p) {
+	int DataLength = p.length() - 8;
+	for (int index = 0; index < DataLength; index += 2) {
+		int valueA = ((int) p[index] - 'a') + (((int) p[index + 1] - 'a') << 4);
+		int valueB = 0;
+		for (int i = 0; i < 4; i++) {
+			int temp = valueA & 0x03;
+			valueA = valueA >> 2;
+			valueB = (valueB << 2);
+			valueB += (temp == 1 ? 3 : (temp == 0 ? 0 : 2));
+		}
+		sendData((byte) valueB);
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void loopD(const std::string &p) {
+	int DataLength = p.length() - 8;
+	for (int index = 0; index < DataLength; index += 2) {
+		int value = ((int) p[index] - 'a') + (((int) p[index + 1] - 'a') << 4);
+		for (int i = 0; i < 4; i++) {
+			int temp = 0;
+			if (value & 0x80) {
+				temp = 0x30;
+			}
+			value = value << 1;
+			if (value & 0x80) {
+				temp |= 0x03;
+			}
+			value = value << 1;
+			sendData((byte) temp);
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void loopE(const std::string &p) {
+	int DataLength = p.length() - 8;
+	for (int index = 0; index < DataLength; index += 2) {
+		int value = ((int) p[index] - 'a') + (((int) p[index + 1] - 'a') << 4);
+		for (int i = 0; i < 2; i++) {
+			int temp = 0;
+			if ((value & 0x03) == 0x03) {
+				temp = 0x40;
+			} else if ((value & 0x03) == 0x01) {
+				temp = 0x30;
+			}
+			value = value >> 2;
+			if ((value & 0x03) == 0x03) {
+				temp |= 0x04;
+			} else if ((value & 0x03) == 0x01) {
+				temp |= 0x03;
+			}
+			value = value >> 2;
+			sendData((byte) temp);
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+// same as EPD_loadTable() in epd.h
+void loadTable(const std::string &p, const byte *table, int width) {
+	int DataLength = p.length() - 8;
+	byte buffer[256];
+	int count = 0;
+	for (int index = 0; index < DataLength; index += 2) {
+		int value = ((int) p[index] - 'a') + (((int) p[index + 1] - 'a') << 4);
+		memcpy_P(buffer + count, table + value * width, width);
+		count += width;
+		if (count > (int) sizeof buffer - width) {
+			sendDataBlock(buffer, count);
+			count = 0;
+		}
+	}
+	if (count > 0) {
+		sendDataBlock(buffer, count);
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+template<typename Load>
+double measure(Load load, std::vector<byte> &output) {
+	auto start = std::chrono::steady_clock::now();
+	for (int round = 0; round < ROUNDS; round++) {
+		sent.clear();
+		load();
+	}
+	auto end = std::chrono::steady_clock::now();
+	output = sent;
+	return std::chrono::duration<double, std::micro>(end - start).count() / ROUNDS;
+}
+
+// -----------------------------------------------------------------------------------------------------
+bool compare(const char *name, const std::string &frame, void (*loop)(const std::string&), const byte *table, int width) {
+	std::vector<byte> loopOutput, tableOutput;
+	double loopMicros = measure([&] { loop(frame); }, loopOutput);
+	double tableMicros = measure([&] { loadTable(frame, table, width); }, tableOutput);
+	bool isSame = loopOutput == tableOutput && loopOutput.size() == (size_t) FRAME_BYTES * width;
+	printf("%s: loop %8.1f us, table %8.1f us per frame, %.1fx, output %s\n", name, loopMicros, tableMicros,
+			loopMicros / tableMicros, isSame ? "identical" : "DIFFERENT");
+	return isSame;
+}
+
+// -----------------------------------------------------------------------------------------------------
+int main() {
+	// every byte value, then random bytes, as the web client encodes them, plus the 8 character trailer
+	std::string frame;
+	srand(1);
+	for (int i = 0; i < FRAME_BYTES; i++) {
+		int value = i < 256 ? i : rand() & 0xFF;
+		frame += (char) ('a' + (value & 0x0F));
+		frame += (char) ('a' + (value >> 4));
+	}
+	frame += "LOADaaaa";
+
+	bool isSame = compare("B", frame, loopB, EPD_tableB, 1);
+	isSame &= compare("D", frame, loopD, EPD_tableD, 4);
+	isSame &= compare("E", frame, loopE, EPD_tableE, 2);
+	return isSame ? 0 : 1;
+}
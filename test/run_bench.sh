@@ -0,0 +1,11 @@
+#!/bin/bash
+# Builds and runs the host benchmark of the pixel expansion tables, see loadtable_bench.cpp
+
+cd "$(dirname "$0")"
+BUILD=/tmp/ESPEInk-bench
+mkdir -p ${BUILD}
+
+# the tables are taken from epd.h, so the benchmark always checks the shipped ones
+tr -d '\r' < ../epd.h | sed -n '/^const byte EPD_table[BDE]\[/,/^};/p' > ${BUILD}/epd_tables.h
+
+g++ -O2 -std=c++11 -Wall -I${BUILD} -o ${BUILD}/loadtable_bench loadtable_bench.cpp && ${BUILD}/loadtable_bench
@@ -0,0 +1,115 @@
+/**
+ * Timing trace of the wake phases, kept in RTC memory over deep sleep.
+ *
+ * Every wake accumulates the time spent per phase (cycle counter based) in
+ * traceCurrent. traceCommit() appends it to a ring buffer of the last
+ * TRACE_RECORDS wakes in RTC user memory right before deep sleep, and
+ * tracePublish() sends the stored records as JSON after the next MQTT connect.
+ */
+
+enum TracePhase {
+	TRACE_SETUP,  // whole setup()
+	TRACE_CONFIG, // getConfig()
+	TRACE_WIFI,   // setupWifi()
+	TRACE_UPDATE, // getUpdate()
+	TRACE_MQTT,   // reconnect()
+	TRACE_SERVER, // web server window until deep sleep
+	TRACE_LOAD,   // all /LOAD requests
+	TRACE_INIT,   // e-Paper initialization
+	TRACE_SHOW,   // e-Paper refresh and sleep
+	TRACE_PHASES
+};
+
+const char *TRACE_NAMES[TRACE_PHASES] = { "setup", "config", "wifi", "update", "mqtt", "server", "load", "init", "show" };
+
+// why the sleep time of a wake was chosen, see getSleepSeconds()
+enum SleepReason {
+	SLEEP_FIXED,   // configured sleep time
+	SLEEP_UPDATED, // adaptive, back to the sleep time after an update
+	SLEEP_BACKOFF, // adaptive, backed off after a wake without update
+	SLEEP_BATTERY, // stretched for a low battery
+	SLEEP_SERVER,  // next wake asked for by the server
+	SLEEP_REASONS
+};
+
+const char *SLEEP_REASON_NAMES[SLEEP_REASONS] = { "fixed", "updated", "backoff", "battery", "server" };
+
+const int TRACE_RECORDS = 6;
+const uint32_t TRACE_MAGIC = 0x45505432; // "EPT2"
+const uint32_t TRACE_RTC_OFFSET = 32;    // in 4-byte blocks, the first 128 bytes are used by OTA
+
+struct TraceRecord {
+	uint32_t duration[TRACE_PHASES]; // microseconds
+	uint16_t loads;
+	uint16_t sequence;
+	uint32_t sleepSeconds;
+	uint16_t batteryMv;   // 0 if not measured
+	uint16_t sleepReason; // SleepReason
+};
+
+struct TraceRing {
+	uint32_t magic;
+	uint16_t head;
+	uint16_t count;
+	uint32_t sequence;
+	TraceRecord records[TRACE_RECORDS];
+};
+
+TraceRing traceRing;
+TraceRecord traceCurrent;
+
+// -----------------------------------------------------------------------------------------------------
+void traceBegin() {
+	if (!ESP.rtcUserMemoryRead(TRACE_RTC_OFFSET, (uint32_t*) &traceRing, sizeof traceRing)
+			|| traceRing.magic != TRACE_MAGIC || traceRing.count > TRACE_RECORDS) {
+		memset(&traceRing, 0, sizeof traceRing);
+		traceRing.magic = TRACE_MAGIC;
+	}
+	memset(&traceCurrent, 0, sizeof traceCurrent);
+	traceCurrent.sequence = traceRing.sequence++;
+}
+
+// -----------------------------------------------------------------------------------------------------
+uint32_t traceStart() {
+	return cpuBaseCycles();
+}
+
+// -----------------------------------------------------------------------------------------------------
+void traceEnd(TracePhase phase, uint32_t startCycle) {
+	traceCurrent.duration[phase] += (cpuBaseCycles() - startCycle) / CPU_BASE_MHZ;
+}
+
+// -----------------------------------------------------------------------------------------------------
+void traceAdd(TracePhase phase, uint32_t microseconds) {
+	traceCurrent.duration[phase] += microseconds;
+}
+
+// -----------------------------------------------------------------------------------------------------
+void traceCommit() {
+	traceRing.records[traceRing.head] = traceCurrent;
+	traceRing.head = (traceRing.head + 1) % TRACE_RECORDS;
+	if (traceRing.count < TRACE_RECORDS) {
+		traceRing.count++;
+	}
+	ESP.rtcUserMemoryWrite(TRACE_RTC_OFFSET, (uint32_t*) &traceRing, sizeof traceRing);
+}
+
+// -----------------------------------------------------------------------------------------------------
+void tracePublish(PubSubClient &client, const char *topic) {
+	while (traceRing.count > 0) {
+		TraceRecord &record = traceRing.records[(traceRing.head + TRACE_RECORDS - traceRing.count) % TRACE_RECORDS];
+		// all fields at their maximum take about 230 bytes, no record is truncated
+		char json[256];
+		int length = snprintf(json, sizeof json, "{\"seq\":%u,\"loads\":%u", (unsigned) record.sequence, (unsigned) record.loads);
+		for (int phase = 0; phase < TRACE_PHASES; ++phase) {
+			length += snprintf(json + length, sizeof json - length, ",\"%s\":%u", TRACE_NAMES[phase], (unsigned) (record.duration[phase] / 1000));
+		}
+		snprintf(json + length, sizeof json - length, ",\"bat\":%u,\"sleep\":%u,\"why\":\"%s\"}", (unsigned) record.batteryMv,
+				(unsigned) record.sleepSeconds, record.sleepReason < SLEEP_REASONS ? SLEEP_REASON_NAMES[record.sleepReason] : "");
+		if (!client.publish(topic, json)) {
+			// the record and the ones after it stay in the ring, traceCommit() keeps them for the next wake
+			return;
+		}
+		traceRing.count--;
+	}
+}
@@ -0,0 +1,124 @@
+/**
+ * Wall clock time over deep sleep.
+ *
+ * Network wakes learn the time by SNTP (clockPoll()). clockSleep() keeps the
+ * time and the intended sleep duration in RTC memory, so the next wake knows
+ * the time without a sync, and shortens or stretches the requested duration by
+ * the drift of the sleep timer. The drift is learned whenever an SNTP sync
+ * follows one or more deep sleeps: the difference between the synced and the
+ * estimated time is spread over the time slept since the last sync.
+ *
+ * Sleeps longer than ESP.deepSleepMax() (about 3.5 h) are chained: they are
+ * split into equal segments and the wakes in between (clockChain() at the very
+ * start of setup()) only count down in RTC memory and sleep on with the RF
+ * disabled, so only the last wake of the chain brings up WiFi.
+ */
+
+const char *CLOCK_NTP_SERVER = "pool.ntp.org";
+const uint32_t CLOCK_MAGIC = 0x45504331; // "EPC1"
+const uint32_t CLOCK_RTC_OFFSET = BEACON_RTC_OFFSET + (sizeof(BeaconState) + 3) / 4; // right after the beacon
+const time_t CLOCK_VALID_EPOCH = 1600000000; // anything before is the unsynced default
+const int32_t CLOCK_DRIFT_LIMIT_PPM = 100000; // larger deviations are measurement errors
+
+struct ClockState {
+	uint32_t magic;
+	int32_t driftPpm;      // the sleep timer runs this much longer than requested
+	uint64_t sleepEpochMs; // wall clock at deep sleep entry, 0 if unknown
+	uint32_t sleepMs;      // intended duration of the last sleep
+	uint32_t unsyncedMs;   // intended durations of all sleeps since the last sync
+	uint32_t chainLeft;    // segments of a chained sleep still to go
+	uint32_t chainSegmentMs; // duration of one segment, drift already corrected
+};
+
+ClockState clockState;
+uint64_t clockBaseMs;   // wall clock at millis() == 0, 0 while unknown
+bool isClockSynced = false;
+
+// -----------------------------------------------------------------------------------------------------
+void clockBegin(bool isDeepSleepWake) {
+	if (!ESP.rtcUserMemoryRead(CLOCK_RTC_OFFSET, (uint32_t*) &clockState, sizeof clockState)
+			|| clockState.magic != CLOCK_MAGIC) {
+		memset(&clockState, 0, sizeof clockState);
+		clockState.magic = CLOCK_MAGIC;
+	}
+	if (isDeepSleepWake && clockState.sleepEpochMs) {
+		clockBaseMs = clockState.sleepEpochMs + clockState.sleepMs;
+	} else {
+		clockBaseMs = 0;
+		clockState.unsyncedMs = 0;
+	}
+	clockState.chainLeft = 0;
+}
+
+// -----------------------------------------------------------------------------------------------------
+void clockChain() {
+	if (ESP.getResetInfoPtr()->reason == REASON_DEEP_SLEEP_AWAKE
+			&& ESP.rtcUserMemoryRead(CLOCK_RTC_OFFSET, (uint32_t*) &clockState, sizeof clockState)
+			&& clockState.magic == CLOCK_MAGIC && clockState.chainLeft > 0) {
+		clockState.chainLeft--;
+		ESP.rtcUserMemoryWrite(CLOCK_RTC_OFFSET, (uint32_t*) &clockState, sizeof clockState);
+		// the RF mode applies to the next wake, only the last one of the chain needs WiFi
+		ESP.deepSleep(clockState.chainSegmentMs * 1000ULL, clockState.chainLeft > 0 ? RF_DISABLED : RF_DEFAULT);
+		delay(100);
+	}
+}
+
+// -----------------------------------------------------------------------------------------------------
+void clockStartSntp() {
+	configTime(0, 0, CLOCK_NTP_SERVER);
+}
+
+// -----------------------------------------------------------------------------------------------------
+void clockPoll() {
+	timeval now;
+	if (isClockSynced || gettimeofday(&now, nullptr) != 0 || now.tv_sec < CLOCK_VALID_EPOCH) {
+		return;
+	}
+	uint64_t syncedBaseMs = now.tv_sec * 1000ULL + now.tv_usec / 1000 - millis();
+	if (clockBaseMs && clockState.unsyncedMs) {
+		// the estimate assumed the intended durations, the difference is the uncorrected drift
+		int64_t errorPpm = (int64_t) (syncedBaseMs - clockBaseMs) * 1000000 / clockState.unsyncedMs;
+		if (errorPpm > -CLOCK_DRIFT_LIMIT_PPM && errorPpm < CLOCK_DRIFT_LIMIT_PPM) {
+			clockState.driftPpm += errorPpm / 2; // damped, single measurements are noisy
+			clockState.driftPpm = constrain(clockState.driftPpm, -CLOCK_DRIFT_LIMIT_PPM, CLOCK_DRIFT_LIMIT_PPM);
+		}
+	}
+	clockBaseMs = syncedBaseMs;
+	clockState.unsyncedMs = 0;
+	isClockSynced = true;
+	LOG_I("Clock synced, sleep drift %d ppm", clockState.driftPpm);
+}
+
+// -----------------------------------------------------------------------------------------------------
+bool clockNow(uint64_t &nowMs) {
+	if (!clockBaseMs) {
+		return false;
+	}
+	nowMs = clockBaseMs + millis();
+	return true;
+}
+
+// -----------------------------------------------------------------------------------------------------
+void clockDeepSleep(long seconds) {
+	uint64_t intendedMs = seconds * 1000ULL;
+	uint64_t nowMs;
+	if (clockNow(nowMs)) {
+		clockState.sleepEpochMs = nowMs;
+		clockState.unsyncedMs += intendedMs;
+	} else {
+		clockState.sleepEpochMs = 0;
+		clockState.unsyncedMs = 0;
+	}
+	clockState.sleepMs = intendedMs;
+
+	uint64_t microseconds = intendedMs * 1000 * 1000000 / (1000000 + clockState.driftPpm);
+	uint64_t segments = microseconds / ESP.deepSleepMax() + 1;
+	clockState.chainLeft = segments - 1;
+	clockState.chainSegmentMs = microseconds / segments / 1000;
+	ESP.rtcUserMemoryWrite(CLOCK_RTC_OFFSET, (uint32_t*) &clockState, sizeof clockState);
+
+	if (segments > 1) {
+		LOG_I("Sleep chained in %d segments", (int) segments);
+	}
+	ESP.deepSleep(microseconds / segments, segments > 1 ? RF_DISABLED : RF_DEFAULT);
+}
@@ -0,0 +1,398 @@
+var srcBox,srcImg,dstImg;
+var epdInd,palArr; // epdArr, epdNam, epdPanels and cfgIP are set by config.js
+var curPal;
+function getElm(n){return document.getElementById(n);}
+function setInn(n,i){ document.getElementById(n).innerHTML=i;}
+function processFiles(files){
+    var file=files[0];
+    var reader=new FileReader();
+    srcImg=new Image();
+    reader.onload=function(e){
+        setInn('srcBox','<img id="imgView" class="sourceImage">');
+        var img=getElm('imgView');
+        img.src=e.target.result;
+        srcImg.src=e.target.result;
+    };
+    reader.readAsDataURL(file);
+}
+function drop(e){
+    e.stopPropagation();
+    e.preventDefault();
+    var files=e.dataTransfer.files;
+    processFiles(files);
+}
+function ignoreDrag(e){
+    e.stopPropagation();
+    e.preventDefault();
+}
+function getNud(nm,vl){
+    return '<td class="comment">'+nm+':</td>'+
+    '<td><input id="nud_'+nm+'" class="nud"type="number" value="'+vl+'"/></td>';
+}
+function Btn(nm,tx,fn){
+    return '<div><label class="menu_button" for="_'+nm+'">'+tx+'</label>'+
+    '<input class="hidden_input" id="_'+nm+'" type="'+
+    (nm==0?'file" onchange="':'button" onclick="')+fn+'"/></div>';
+}
+function RB(vl,tx){
+    return '<input type="radio" name="kind" value="m'+vl+
+    '" onclick="rbClick('+vl+');"'+(vl==epdInd?'checked="true"':'')+'/>'+tx;
+}
+window.onload = function(){
+    srcBox = getElm('srcBox');
+    srcBox.ondragenter=ignoreDrag;
+    srcBox.ondragover=ignoreDrag;
+    srcBox.ondrop=drop;
+    srcImg=0;
+    // a build for a single e-Paper type has the names of the others empty
+    for(epdInd=0;epdInd<epdNam.length-1&&!epdNam[epdInd];epdInd++);
+    palArr=[[[0,0,0],[255,255,255]],
+    [[0,0,0],[255,255,255],[127,0,0]],
+    [[0,0,0],[255,255,255],[127,127,127]],
+    [[0,0,0],[255,255,255],[127,127,127],[127,0,0]],
+    [[0,0,0],[255,255,255]],
+    [[0,0,0],[255,255,255],[220,180,0]],
+    [[0,0,0]],
+    [[0,0,0],[255,255,255],[0,255,0],[0,0,255],[255,0,0],[255,255,0],[255,128,0]]];
+    getElm('ip_addr').value=cfgIP;
+    if(epdPanels>1){
+        getElm('PN').style.display='';
+        getElm('panel').max=epdPanels-1;
+    }
+    setInn('BT',
+    Btn(0,'Select image file','processFiles(this.files);')+
+    Btn(1,'Level: mono','procImg(true,false);')+
+    Btn(2,'Level: color','procImg(true,true);')+
+    Btn(3,'Dithering: mono','procImg(false,false);')+
+    Btn(4,'Dithering: color','procImg(false,true);')+
+    Btn(5,'Upload image','uploadImage();'));
+    setInn('XY',getNud('x','0')+getNud('y','0'));
+    setInn('WH',getNud('w',''+epdArr[epdInd][0])+getNud('h',''+epdArr[epdInd][1]));
+    var rb='',n=0;
+    for(var i=0;i<epdNam.length;i++)if(epdNam[i])rb+=(n++==0?'':(n%3==1?'<br>':'&ensp;'))+RB(i,epdNam[i].replace(' inch','').trim());
+    setInn('RB',rb);
+}
+function rbClick(index){
+    getElm('nud_w').value=+epdArr[index][0];
+    getElm('nud_h').value=+epdArr[index][1];
+    epdInd=index;
+}
+var source;
+var dX, dY, dW, dH, sW, sH;
+function getVal(p, i){
+    if((p.data[i]==0x00) && (p.data[i+1]==0x00))return 0;
+    if((p.data[i]==0xFF) && (p.data[i+1]==0xFF))return 1;
+    if((p.data[i]==0x7F) && (p.data[i+1]==0x7F))return 2;
+    return 3;
+}
+function setVal(p,i,c){
+    p.data[i]=curPal[c][0];
+    p.data[i+1]=curPal[c][1];
+    p.data[i+2]=curPal[c][2];
+    p.data[i+3]=255;
+}
+function getVal_7color(p, i) {
+    if((p.data[i]==0x00) && (p.data[i+1]==0x00) && (p.data[i+2]==0x00))return 0;
+    if((p.data[i]==0xFF) && (p.data[i+1]==0xFF) && (p.data[i+2]==0xFF))return 1;
+    if((p.data[i]==0x00) && (p.data[i+1]==0xFF) && (p.data[i+2]==0x00))return 2;
+    if((p.data[i]==0x00) && (p.data[i+1]==0x00) && (p.data[i+2]==0xFF))return 3;
+    if((p.data[i]==0xFF) && (p.data[i+1]==0x00) && (p.data[i+2]==0x00))return 4;
+    if((p.data[i]==0xFF) && (p.data[i+1]==0xFF) && (p.data[i+2]==0x00))return 5;
+    if((p.data[i]==0xFF) && (p.data[i+1]==0x80) && (p.data[i+2]==0x00))return 6;
+    return 7;
+}
+function addVal(c,r,g,b,k){
+    return[c[0]+(r*k)/32,c[1]+(g*k)/32,c[2]+(b*k)/32];
+}
+function getErr(r,g,b,stdCol){
+    r-=stdCol[0];
+    g-=stdCol[1];
+    b-=stdCol[2];
+    return r*r + g*g + b*b;
+}
+function getNear(r,g,b){
+    var ind=0;
+    var err=getErr(r,g,b,curPal[0]);
+    for (var i=1;i<curPal.length;i++)
+    {
+        var cur=getErr(r,g,b,curPal[i]);
+        if (cur<err){err=cur;ind=i;}
+    }
+    return ind;
+}
+function procImg(isLvl,isRed){
+    if (document.getElementsByClassName('sourceImage').length == 0){
+        alert('First select image');
+        return;
+    }
+    var palInd=epdArr[epdInd][2];
+    if (isRed&&((palInd&1)==0)){
+        alert('This white-black display');
+        return;
+    }
+    if (!isRed)palInd=palInd&0xFE;
+    curPal=palArr[palInd];
+    getElm('dstBox').innerHTML=
+    '<span class="title">Processed image</span><br><canvas id="canvas"></canvas>';
+    var canvas=getElm('canvas');
+    sW=srcImg.width;
+    sH=srcImg.height;
+    source=getElm('source');
+    source.width=sW;
+    source.height=sH;
+    source.getContext('2d').drawImage(srcImg,0,0,sW,sH);
+    dX=parseInt(getElm('nud_x').value);
+    dY=parseInt(getElm('nud_y').value);
+    dW=parseInt(getElm('nud_w').value);
+    dH=parseInt(getElm('nud_h').value);
+    if((dW<3)||(dH<3)){
+        alert('Image is too small');
+        return;
+    }
+    canvas.width=dW;
+    canvas.height=dH;
+    var index=0;
+    var pSrc=source.getContext('2d').getImageData(0,0,sW,sH);
+    var pDst=canvas.getContext('2d').getImageData(0,0,dW,dH);
+    if(isLvl){
+        for (var j=0;j<dH;j++){
+            var y=dY+j;
+            if ((y<0)||(y>=sH)){
+                for (var i=0;i<dW;i++,index+=4) setVal(pDst,index,(i+j)%2==0?1:0);
+                continue;
+            }
+            for (var i=0;i<dW;i++){
+                var x=dX+i;
+                if ((x<0)||(x>=sW)){
+                    setVal(pDst,index,(i+j)%2==0?1:0);
+                    index+=4;
+                    continue;
+                }
+                var pos=(y*sW+x)*4;
+                setVal(pDst,index,getNear(pSrc.data[pos],pSrc.data[pos+1],pSrc.data[pos+2]));
+                index+=4;
+            }
+        }
+    }else{
+        var aInd=0;
+        var bInd=1;
+        var errArr=new Array(2);
+        errArr[0]=new Array(dW);
+        errArr[1]=new Array(dW);
+        for (var i=0;i<dW;i++)
+        errArr[bInd][i]=[0,0,0];
+        for (var j=0;j<dH;j++){
+            var y=dY+j;
+            if ((y<0)||(y>=sH)){
+                for (var i=0;i<dW;i++,index+=4)setVal(pDst,index,(i+j)%2==0?1:0);
+                continue;
+            }
+            aInd=((bInd=aInd)+1)&1;
+            for (var i=0;i<dW;i++)errArr[bInd][i]=[0,0,0];
+            for (var i=0;i<dW;i++){
+                var x=dX+i;
+                if ((x<0)||(x>=sW)){
+                    setVal(pDst,index,(i+j)%2==0?1:0);
+                    index+=4;
+                    continue;
+                }
+                var pos=(y*sW+x)*4;
+                var old=errArr[aInd][i];
+                var r=pSrc.data[pos  ]+old[0];
+                var g=pSrc.data[pos+1]+old[1];
+                var b=pSrc.data[pos+2]+old[2];
+                var colVal = curPal[getNear(r,g,b)];
+                pDst.data[index++]=colVal[0];
+                pDst.data[index++]=colVal[1];
+                pDst.data[index++]=colVal[2];
+                pDst.data[index++]=255;
+                r=(r-colVal[0]);
+                g=(g-colVal[1]);
+                b=(b-colVal[2]);
+                if (i==0){
+                    errArr[bInd][i  ]=addVal(errArr[bInd][i  ],r,g,b,7.0);
+                    errArr[bInd][i+1]=addVal(errArr[bInd][i+1],r,g,b,2.0);
+                    errArr[aInd][i+1]=addVal(errArr[aInd][i+1],r,g,b,7.0);
+                }else if (i==dW-1){
+                    errArr[bInd][i-1]=addVal(errArr[bInd][i-1],r,g,b,7.0);
+                    errArr[bInd][i  ]=addVal(errArr[bInd][i  ],r,g,b,9.0);
+                }else{
+                    errArr[bInd][i-1]=addVal(errArr[bInd][i-1],r,g,b,3.0);
+                    errArr[bInd][i  ]=addVal(errArr[bInd][i  ],r,g,b,5.0);
+                    errArr[bInd][i+1]=addVal(errArr[bInd][i+1],r,g,b,1.0);
+                    errArr[aInd][i+1]=addVal(errArr[aInd][i+1],r,g,b,7.0);
+                }
+            }
+        }
+    }
+    canvas.getContext('2d').putImageData(pDst,0,0);
+}
+var pxInd,stInd;
+var dispW,dispH;
+var xhReq,dispX;
+var rqPrf,rqMsg;
+var prvPx,prvSt;
+function ldPrv(){if(xhReq.status!=200){pxInd=prvPx;stInd=prvSt;}}
+function svPrv(){prvPx=pxInd;prvSt=stInd;}
+function byteToStr(v){return String.fromCharCode((v & 0xF) + 97, ((v >> 4) & 0xF) + 97);}
+function wordToStr(v){return byteToStr(v&0xFF) + byteToStr((v>>8)&0xFF);}
+function u_send(cmd,next){
+    xhReq.open('POST',rqPrf+cmd, true);
+    xhReq.send();
+    if(next)stInd++;
+    return 0;
+}
+function u_next(){
+    lnInd=0;
+    pxInd=0;
+    u_send('NEXT',true);
+}
+function u_done(){
+    setInn('logTag','Complete!');
+    return u_send('SHOW',true);
+}
+function u_loadA(a,k1,k2){
+    var x=''+(k1+k2*pxInd/a.length);
+    if(x.length>5)x=x.substring(0,5);
+    setInn('logTag','Progress: '+x+'%');
+    xhReq.open('POST',rqPrf+'LOAD', true);
+    xhReq.send(rqMsg+wordToStr(rqMsg.length)+'LOAD');
+    if(pxInd>=a.length)stInd++;
+    return 0;
+}
+function u_loadB(a,k1,k2){
+    var x=''+(k1+k2*pxInd/a.length);
+    if(x.length>5)x=x.substring(0,5);
+    setInn('logTag','Progress: '+x+'%');
+    xhReq.open('POST',rqPrf+'LOAD', true);
+    xhReq.send(rqMsg+wordToStr(rqMsg.length)+'LOAD');
+    if(pxInd>=a.length)stInd++;
+    return 0;
+}
+function u_dataA(a,c,k1,k2)
+{
+    rqMsg='';
+    svPrv();
+    if(c==-1)
+    {
+        while((pxInd<a.length)&&(rqMsg.length<1500))
+        {
+            var v=0;
+            for (var i=0;i<16;i+=2)
+            {
+                if(pxInd<a.length)v|=(a[pxInd]<<i);
+                pxInd++;
+            }
+            rqMsg += wordToStr(v);
+        }
+    }
+    else if(c==-2)
+    {
+        while((pxInd<a.length)&&(rqMsg.length<1500))
+        {
+            var v=0;
+            for (var i=0;i<16;i+=4)if(pxInd<a.length)v|=(a[pxInd++]<<i);
+            rqMsg += wordToStr(v);
+        }
+    }
+    else{
+        while((pxInd<a.length)&&(rqMsg.length<1500))
+        {
+            var v=0;
+            for (var i=0;i<8;i++)
+            {
+                if((pxInd<a.length)&&(a[pxInd]!=c))v|=(128>>i);
+                pxInd++;
+            }
+            rqMsg += byteToStr(v);
+        }
+    }
+    return u_loadA(a,k1,k2);
+}
+function u_dataB(a,c,k1,k2){
+    var x;
+    rqMsg='';
+    svPrv();
+    while(rqMsg.length<1500)
+    {
+        x=0;
+        while(x<122)
+        {
+            var v=0;
+            for (var i=0;(i<8)&&(x<122);i++,x++)if(a[pxInd++]!=c)v|=(128>>i);
+            rqMsg += byteToStr(v);
+        }
+    }
+    return u_loadB(a,k1,k2);
+}
+function uploadImage(){
+    var c=getElm('canvas');
+    var w=dispW=c.width;
+    var h=dispH=c.height;
+    var p=c.getContext('2d').getImageData(0,0,w,h);
+    var a=new Array(w*h);
+    var i=0;
+    var mode=epdArr[epdInd][3];
+    for(var y=0;y<h;y++)for(var x=0;x<w;x++,i++) {
+        if(mode==2)
+        a[i]=getVal_7color(p,i<<2);
+        else
+        a[i]=getVal(p,i<<2);
+    }
+    dispX=0;
+    pxInd=0;
+    stInd=0;
+    xhReq=new XMLHttpRequest();
+    // further panels are addressed by a path prefix
+    var pnl=+getElm('panel').value;
+    var pth=pnl>0?pnl+'/':'';
+    rqPrf='http://'+getElm('ip_addr').value+'/'+pth;
+    var init=pth+'EPD';
+    if (mode==3){
+        xhReq.onload=xhReq.onerror = function(){
+            ldPrv();
+            if(stInd==0)return u_dataB(a,0,0,100);
+            if(stInd==1)return u_done();
+        };
+        xhReq.open('POST',init, true);
+        xhReq.send(byteToStr(epdInd));
+        return 0;
+    }
+    if (mode==4){
+        xhReq.onload=xhReq.onerror = function(){
+            ldPrv();
+            if(stInd==0)return u_dataB(a,0,0,50);
+            if(stInd==1)return u_next();
+            if(stInd==2)return u_dataB(a,3,50,50);
+            if(stInd==3)return u_done();
+        };
+        xhReq.open('POST',init, true);
+        xhReq.send(byteToStr(epdInd));
+        return 0;
+    }
+    if (mode<3){
+        xhReq.onload=xhReq.onerror=function(){
+            ldPrv();
+            if(stInd==0)return u_dataA(a,-mode,0,100);
+            if(stInd==1)return u_done();
+        };
+        xhReq.open('POST',init, true);
+        xhReq.send(byteToStr(epdInd));
+        return 0;
+    }
+    else{
+        xhReq.onload=xhReq.onerror=function(){
+            ldPrv();
+            if(stInd==0&&xhReq.responseText.indexOf('planes')>=0)stInd=4;
+            if(stInd==4)return u_dataA(a,-1,0,100);
+            if(stInd==5)return u_done();
+            if(stInd==0)return u_dataA(a,mode==6?-1:0,0,50);
+            if(stInd==1)return u_next();
+            if(stInd==2)return u_dataA(a,3,50,50);
+            if(stInd==3)return u_done();
+        };
+        xhReq.open('POST',init, true);
+        xhReq.send(byteToStr(epdInd)+'2');
+        return 0;
+    }
+}
@@ -0,0 +1,40 @@
+#!/bin/bash
+# Bundles the web UI in web/ into gzip compressed PROGMEM arrays in webui.h.
+# Styles and script are referenced with their ETag as version, so index.html
+# is compressed last.
+
+cd "$(dirname "$0")"
+OUT=../webui.h
+TMP=$(mktemp)
+trap 'rm -f ${TMP}' EXIT
+
+# asset <name> <file>: compresses the file, sets ETAG and appends the array
+asset() {
+	gzip -9 -n -c "$2" > ${TMP}
+	ETAG=$(sha1sum ${TMP} | cut -c1-16)
+	{
+		echo "const char WEB_$1_ETAG[] = \"\\\"${ETAG}\\\"\";"
+		echo "const uint8_t WEB_$1[] PROGMEM = {"
+		od -An -v -tx1 ${TMP} | sed -e 's/ \([0-9a-f][0-9a-f]\)/0x\1, /g' -e 's/^/\t/' -e 's/, $/,/'
+		echo "};"
+		echo
+	} >> ${OUT}
+}
+
+{
+	echo "/**"
+	echo " * Web UI, generated from web/ by web/bundle.sh - do not edit."
+	echo " */"
+	echo
+} > ${OUT}
+
+# leading whitespace is only for reading the sources
+sed -e 's/^[ \t]*//' styles.css > styles.min.css
+sed -e 's/^[ \t]*//' app.js > app.min.js
+asset CSS styles.min.css
+CSS_ETAG=${ETAG}
+asset JS app.min.js
+JS_ETAG=${ETAG}
+sed -e "s/{{CSS_ETAG}}/${CSS_ETAG}/" -e "s/{{JS_ETAG}}/${JS_ETAG}/" index.html > index.min.html
+asset HTML index.min.html
+rm -f styles.min.css app.min.js index.min.html
@@ -0,0 +1,303 @@
+/**
+ * Web UI, generated from web/ by web/bundle.sh - do not edit.
+ */
+
+const char WEB_CSS_ETAG[] = "\"a545cb539522ebfc\"";
+const uint8_t WEB_CSS[] PROGMEM = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x54, 0xc1, 0x6e, 0xa3, 0x30,
+	0x10, 0xbd, 0xf3, 0x15, 0x96, 0xaa, 0x4a, 0xad, 0x14, 0x52, 0x48, 0x93, 0x34, 0x75, 0x4e, 0xdd,
+	0x6c, 0xf3, 0x05, 0xab, 0xbd, 0x56, 0x13, 0x6c, 0xc0, 0xaa, 0xb1, 0x91, 0x6d, 0xb6, 0x49, 0xab,
+	0xfd, 0xf7, 0x1d, 0x1b, 0x48, 0xa0, 0x4d, 0xbb, 0x87, 0x72, 0x88, 0x00, 0x67, 0xde, 0x7b, 0xf3,
+	0xe6, 0x0d, 0xd3, 0x8a, 0xab, 0xe6, 0x69, 0xd7, 0x38, 0xa7, 0x15, 0x79, 0x8b, 0x5e, 0x04, 0x73,
+	0x25, 0x25, 0x69, 0x92, 0x5c, 0xae, 0xa3, 0x92, 0x8b, 0xa2, 0x74, 0x94, 0xdc, 0x26, 0xf5, 0x7e,
+	0x1d, 0xed, 0xb4, 0x61, 0xdc, 0xc4, 0x06, 0x98, 0x68, 0x2c, 0x25, 0x73, 0xff, 0xce, 0xf1, 0xbd,
+	0x8b, 0x41, 0x8a, 0x42, 0x51, 0x92, 0x71, 0xe5, 0xb8, 0x59, 0x47, 0x59, 0x63, 0xac, 0x36, 0x94,
+	0xd4, 0x5a, 0xb4, 0x2f, 0x98, 0xb0, 0xb5, 0x84, 0x03, 0x25, 0x3b, 0xa9, 0xb3, 0xe7, 0x75, 0x54,
+	0x81, 0x29, 0x84, 0x8a, 0x77, 0x1a, 0x39, 0x2b, 0xba, 0xf0, 0x38, 0xb9, 0x56, 0xc8, 0x93, 0x22,
+	0xe6, 0x8d, 0x27, 0x23, 0xbf, 0xa0, 0xd4, 0x15, 0x20, 0xbe, 0x01, 0x65, 0x85, 0x13, 0x1a, 0xf1,
+	0x41, 0x4a, 0x92, 0x4c, 0xd3, 0x95, 0x25, 0x1c, 0x2c, 0x8f, 0x11, 0x41, 0x37, 0xae, 0x97, 0x85,
+	0xc5, 0x58, 0x66, 0xb5, 0x14, 0x8c, 0x5c, 0xcc, 0xb7, 0x3f, 0x97, 0xcb, 0x25, 0x1e, 0x41, 0xf6,
+	0x5c, 0x18, 0xdd, 0x28, 0x46, 0x89, 0x14, 0x8a, 0x83, 0x89, 0x0b, 0x2f, 0x1f, 0x85, 0x5e, 0x39,
+	0x4d, 0x9c, 0xae, 0x89, 0xf1, 0x1d, 0x4e, 0xc8, 0xc5, 0xed, 0xe3, 0xe6, 0xfe, 0xee, 0x01, 0x6f,
+	0x96, 0xf7, 0x8f, 0x0f, 0xf3, 0x7b, 0x32, 0x4b, 0x2e, 0x27, 0xc4, 0x14, 0x3b, 0xb8, 0x9a, 0x2d,
+	0x16, 0x13, 0x72, 0xfa, 0x49, 0xae, 0xc9, 0xea, 0xf3, 0xb3, 0xeb, 0x13, 0xe8, 0xcd, 0x02, 0x3d,
+	0x24, 0x8b, 0x60, 0x64, 0xa6, 0xa5, 0x77, 0xa4, 0x30, 0x9c, 0xab, 0x75, 0xf4, 0x37, 0x9a, 0x0e,
+	0x4c, 0xa7, 0xa5, 0xfe, 0xc3, 0x0d, 0x5a, 0xdf, 0xfd, 0xe9, 0xa5, 0x14, 0x8e, 0x0f, 0xb5, 0xc7,
+	0xb5, 0xee, 0x2d, 0x68, 0x2d, 0x23, 0x92, 0xe7, 0x2e, 0xc0, 0x94, 0x82, 0x31, 0xae, 0x9e, 0x84,
+	0xaa, 0x1b, 0x77, 0x1a, 0x1e, 0x9a, 0xe4, 0x3d, 0xed, 0xa7, 0xd7, 0x3d, 0xea, 0x1a, 0x32, 0xe1,
+	0x70, 0x0a, 0x09, 0xde, 0x23, 0x63, 0x2e, 0xf5, 0x0b, 0x25, 0x2d, 0xc2, 0x3a, 0x3a, 0x71, 0xc0,
+	0x0e, 0x5d, 0x6c, 0xbc, 0x84, 0x57, 0xf4, 0x98, 0xf1, 0x3d, 0x25, 0x71, 0x1a, 0xd8, 0x44, 0x55,
+	0xfc, 0xd0, 0xfb, 0xe8, 0xed, 0x68, 0xf9, 0x0c, 0x2d, 0x67, 0x60, 0x4b, 0xce, 0xfa, 0xd6, 0xde,
+	0x65, 0x64, 0x15, 0x72, 0x33, 0x9a, 0x02, 0x4a, 0x3a, 0x70, 0x89, 0xdc, 0xa3, 0x16, 0x0d, 0xaf,
+	0x39, 0xa0, 0x56, 0xa5, 0xbb, 0xdb, 0xf3, 0xd1, 0xea, 0x92, 0x83, 0x1e, 0xd3, 0x34, 0x64, 0x32,
+	0x58, 0x69, 0x51, 0x15, 0x76, 0xdf, 0x1e, 0x86, 0xec, 0xa2, 0xae, 0xbb, 0x70, 0x3e, 0x36, 0xde,
+	0xa7, 0x2c, 0xb6, 0xe2, 0x95, 0xa3, 0xf4, 0x63, 0xec, 0xe2, 0x1c, 0x2a, 0x21, 0xd1, 0x97, 0xdf,
+	0xdc, 0x30, 0x50, 0x30, 0x21, 0x0f, 0x46, 0x80, 0x9c, 0x10, 0x8b, 0xd1, 0x8b, 0x2d, 0x37, 0x22,
+	0x6f, 0xbd, 0xe6, 0x80, 0xad, 0x3d, 0x79, 0xd1, 0x51, 0x6f, 0xf5, 0x68, 0x4d, 0x02, 0xef, 0xa8,
+	0xdd, 0x8b, 0xc7, 0x70, 0x85, 0xf2, 0x0c, 0xa9, 0xb0, 0x8b, 0x73, 0xf5, 0x9f, 0x54, 0xe4, 0x5a,
+	0xbb, 0x6f, 0x10, 0x76, 0x7a, 0x73, 0xc8, 0xf8, 0xa0, 0x7c, 0x36, 0x1f, 0x44, 0xa3, 0x03, 0xe8,
+	0x8c, 0x4b, 0x08, 0x34, 0x4e, 0x8f, 0xf1, 0x36, 0x9b, 0xed, 0x76, 0xb3, 0x19, 0x35, 0xf0, 0x1f,
+	0xc0, 0xcb, 0x2f, 0xf1, 0xb6, 0xe1, 0x1a, 0xb6, 0xf7, 0x2d, 0xb8, 0x81, 0xbc, 0x76, 0xa3, 0xc0,
+	0x1c, 0xe3, 0x19, 0x9b, 0x16, 0xe3, 0xcb, 0xcf, 0x02, 0x1a, 0xb6, 0xdd, 0x7a, 0xc3, 0x70, 0x21,
+	0x9c, 0xc8, 0x40, 0x76, 0x89, 0xc3, 0x84, 0xe1, 0x4e, 0x00, 0x63, 0x42, 0x15, 0x34, 0x0d, 0x59,
+	0x69, 0x15, 0xce, 0x5a, 0xcb, 0x06, 0x02, 0x47, 0xc3, 0xd5, 0xec, 0x80, 0x02, 0xce, 0x81, 0x0d,
+	0xe2, 0xdc, 0xa7, 0x79, 0xd4, 0x65, 0x4f, 0xd6, 0x7e, 0x6b, 0xbb, 0xa7, 0xd8, 0x6f, 0x7a, 0xc7,
+	0x8f, 0x34, 0x4e, 0x38, 0xe9, 0xcd, 0x6a, 0x53, 0xfd, 0x21, 0xd4, 0xb7, 0xb3, 0x0f, 0x99, 0x06,
+	0x1f, 0xe5, 0x6e, 0x7c, 0x15, 0x5a, 0xe4, 0xde, 0x25, 0xe9, 0x13, 0xa4, 0x74, 0x79, 0x44, 0xb2,
+	0xee, 0x20, 0x39, 0x15, 0x0e, 0xa5, 0x67, 0xe7, 0xc1, 0xcf, 0x74, 0x86, 0x7c, 0xaa, 0x61, 0x47,
+	0xae, 0xbb, 0x6e, 0x57, 0xff, 0x01, 0x7c, 0xa5, 0xfc, 0x1f, 0x6c, 0x06, 0x00, 0x00,
+};
+
+const char WEB_JS_ETAG[] = "\"1c6560bbb1f867ee\"";
+const uint8_t WEB_JS[] PROGMEM = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x1a, 0xfb, 0x4f, 0xdb, 0x48,
+	0xf3, 0xf7, 0xfc, 0x15, 0x5b, 0xa4, 0x62, 0x1b, 0x9b, 0x24, 0x36, 0x70, 0xf4, 0x48, 0x36, 0x55,
+	0x81, 0x56, 0x20, 0xf5, 0x81, 0x5a, 0xee, 0xa0, 0x42, 0x11, 0x72, 0xec, 0x4d, 0xe2, 0xe2, 0xd8,
+	0xbe, 0xb5, 0xf3, 0x12, 0xc7, 0xff, 0xfe, 0xcd, 0xce, 0xae, 0x5f, 0x21, 0x81, 0xf6, 0x7a, 0x8f,
+	0x1f, 0x3e, 0xa1, 0x24, 0xde, 0xdd, 0x99, 0xd9, 0x99, 0xd9, 0x79, 0xae, 0x99, 0xb9, 0x9c, 0xa4,
+	0xdc, 0x3b, 0x8e, 0x17, 0x16, 0xfc, 0x9c, 0x4f, 0x46, 0x96, 0x9f, 0x66, 0xf0, 0xd3, 0x69, 0xcc,
+	0x60, 0x85, 0x25, 0xfe, 0x79, 0xe4, 0x5b, 0x89, 0x1b, 0xbe, 0xe1, 0xbc, 0x43, 0x5a, 0x2d, 0x31,
+	0x03, 0x8f, 0x96, 0xf8, 0xfd, 0xe8, 0x4e, 0xf0, 0xf7, 0xc2, 0x8d, 0x58, 0x98, 0x12, 0x37, 0xf2,
+	0x89, 0x37, 0x1c, 0x9d, 0x5f, 0x10, 0x97, 0x33, 0x92, 0xb2, 0x8c, 0x0c, 0x96, 0xc4, 0x8b, 0xa3,
+	0x61, 0x30, 0x6a, 0x7e, 0x4b, 0x91, 0x9c, 0x37, 0xe5, 0x17, 0x6e, 0xd8, 0x69, 0x0c, 0xa7, 0x91,
+	0x97, 0x05, 0x71, 0x44, 0x46, 0x2c, 0x7b, 0x1b, 0x4e, 0xf4, 0xc8, 0xb8, 0xe7, 0x2c, 0x9b, 0xf2,
+	0x88, 0xf8, 0xb1, 0x37, 0x9d, 0xb0, 0x28, 0x6b, 0xe2, 0x0a, 0x13, 0x8f, 0xc7, 0xcb, 0x73, 0x1f,
+	0x20, 0x3a, 0x0f, 0x25, 0x1a, 0x10, 0x3f, 0x8f, 0x22, 0x3d, 0xb2, 0x02, 0xe3, 0xfe, 0x09, 0x94,
+	0x66, 0x10, 0x45, 0x8c, 0x9f, 0x5d, 0x7e, 0x78, 0x4f, 0x83, 0x2a, 0x7a, 0xc2, 0x63, 0x8f, 0xa5,
+	0xe9, 0xbb, 0x20, 0x64, 0xa9, 0x3e, 0x14, 0xdf, 0xc6, 0x3d, 0xf2, 0x27, 0x9e, 0x29, 0x4e, 0xdc,
+	0xb4, 0xfb, 0x52, 0x03, 0x9c, 0xb9, 0x3e, 0xe3, 0x34, 0x62, 0x73, 0x22, 0xe0, 0x3f, 0xe3, 0x50,
+	0x37, 0x3a, 0x0d, 0xa9, 0x2d, 0x5c, 0x38, 0x9f, 0xb8, 0x23, 0x26, 0xe6, 0x24, 0x70, 0x33, 0x8e,
+	0xc2, 0xd8, 0xf5, 0x69, 0xbe, 0x9f, 0xce, 0x80, 0xbc, 0x62, 0x59, 0x93, 0xba, 0xd6, 0x2c, 0xad,
+	0x1b, 0x4c, 0x46, 0x24, 0xf0, 0xe9, 0x16, 0xfc, 0xfe, 0x1e, 0xb0, 0xf9, 0x16, 0xf1, 0x42, 0x37,
+	0x4d, 0xe9, 0x56, 0x1a, 0x4f, 0xb9, 0xc7, 0x90, 0xe6, 0x56, 0x4f, 0x33, 0x24, 0x1b, 0x00, 0x44,
+	0x95, 0xb2, 0x34, 0x85, 0x20, 0x96, 0xe0, 0xb1, 0x09, 0x14, 0x29, 0x6b, 0x66, 0x2e, 0x87, 0xf5,
+	0x26, 0x67, 0xe9, 0x34, 0xcc, 0x72, 0xee, 0xd6, 0xaf, 0x3d, 0x14, 0x8c, 0x8a, 0x9f, 0x37, 0xe9,
+	0xa9, 0x9b, 0xb9, 0xbf, 0x7d, 0x7e, 0x8f, 0x9a, 0x00, 0x9a, 0x15, 0x45, 0xf9, 0x3c, 0x4e, 0x90,
+	0x7b, 0xd6, 0x4c, 0xb3, 0x38, 0xb9, 0x80, 0xa1, 0x3b, 0x72, 0x51, 0x26, 0x00, 0x64, 0xcd, 0x84,
+	0xb3, 0x19, 0xa8, 0xfb, 0x94, 0x0d, 0x5d, 0xa0, 0xac, 0x2b, 0x5e, 0x51, 0x81, 0xb0, 0xad, 0x0f,
+	0x74, 0x2f, 0xb9, 0x1b, 0xa5, 0x43, 0xd8, 0x0a, 0x27, 0x3b, 0x8d, 0x35, 0xaa, 0xaf, 0xed, 0x18,
+	0x8c, 0xa2, 0x98, 0xb3, 0x53, 0xee, 0x8e, 0x7e, 0x6c, 0xdf, 0x87, 0x9a, 0x4d, 0x7d, 0x9c, 0xc2,
+	0xf1, 0x4f, 0xac, 0x59, 0x08, 0x24, 0x94, 0x61, 0x69, 0xdd, 0xcc, 0xcf, 0x35, 0xec, 0xc5, 0x13,
+	0x61, 0x25, 0xa0, 0x5d, 0x33, 0x9a, 0x98, 0xda, 0x51, 0xb7, 0x95, 0xf9, 0xf0, 0xdc, 0x10, 0x30,
+	0xbd, 0x6e, 0x10, 0x25, 0xd3, 0x0c, 0x4f, 0x26, 0x9a, 0xfa, 0xb7, 0x12, 0xa4, 0x38, 0x1c, 0x98,
+	0xda, 0xca, 0x96, 0x09, 0x13, 0x4f, 0x93, 0x01, 0xe3, 0x5b, 0x64, 0xe6, 0x86, 0x53, 0x18, 0x6a,
+	0xe6, 0x2c, 0x04, 0xb8, 0x56, 0x4f, 0x12, 0xab, 0x71, 0x74, 0x9c, 0x45, 0x82, 0x9d, 0x6c, 0x61,
+	0x0d, 0xa3, 0x2a, 0x47, 0x7e, 0x30, 0xeb, 0x75, 0x43, 0x77, 0xc0, 0xc2, 0x9c, 0x3c, 0xb0, 0x35,
+	0xbd, 0x1d, 0x4c, 0xb3, 0x2c, 0x8e, 0xb6, 0xc8, 0x30, 0xe6, 0x74, 0x2b, 0x67, 0x00, 0xf8, 0xcb,
+	0x16, 0xa6, 0xd6, 0x6d, 0x21, 0xbc, 0xe4, 0x56, 0x72, 0xaa, 0x50, 0xc7, 0x81, 0xef, 0xb3, 0xe8,
+	0x16, 0xe7, 0xb6, 0x90, 0xfd, 0x82, 0x77, 0xc9, 0x30, 0xa0, 0x00, 0x17, 0x94, 0xb6, 0x5f, 0x6b,
+	0x42, 0xf1, 0x5b, 0x24, 0x8e, 0xbc, 0xb1, 0x1b, 0x8d, 0xc4, 0xd2, 0x91, 0x96, 0x6f, 0x0a, 0x93,
+	0x61, 0xe0, 0xdd, 0xc1, 0x9c, 0x61, 0x0e, 0x23, 0x25, 0x91, 0x60, 0xb4, 0x2e, 0xd2, 0xe7, 0x63,
+	0x7d, 0x16, 0x82, 0x44, 0x55, 0x71, 0x24, 0x3b, 0x72, 0x33, 0xee, 0xfa, 0x41, 0xbc, 0x45, 0x22,
+	0x77, 0x02, 0x83, 0xbb, 0x20, 0xf2, 0x0b, 0x45, 0x4d, 0x50, 0x53, 0x0d, 0xad, 0xb2, 0x15, 0x1f,
+	0x9c, 0x88, 0x07, 0x5d, 0xea, 0xd0, 0xe8, 0x00, 0xab, 0x40, 0x9d, 0x52, 0x19, 0x7d, 0x5e, 0x6b,
+	0xde, 0x98, 0x79, 0x77, 0x0c, 0x24, 0xca, 0xf8, 0x94, 0x09, 0x66, 0x81, 0x37, 0xad, 0x85, 0x1a,
+	0x11, 0x4c, 0xcd, 0x81, 0x7c, 0x3c, 0x57, 0x5e, 0x47, 0x28, 0x29, 0xfc, 0x4e, 0xb8, 0x1d, 0xba,
+	0x1b, 0x4c, 0xe6, 0xce, 0xa3, 0xfc, 0x4f, 0x3a, 0x30, 0x3c, 0x01, 0x9a, 0x0f, 0xd6, 0x06, 0xe6,
+	0x00, 0x5e, 0x5e, 0x5a, 0xdf, 0xca, 0x72, 0x3c, 0xdb, 0xbc, 0x1a, 0x27, 0x54, 0x7c, 0x15, 0x11,
+	0xa1, 0xdd, 0x69, 0x40, 0x9c, 0x74, 0xc9, 0x60, 0x1a, 0x84, 0xbe, 0x38, 0x44, 0x78, 0x4e, 0x83,
+	0x68, 0x14, 0x32, 0xc2, 0x76, 0x2f, 0xdc, 0x84, 0x71, 0xd4, 0x11, 0x19, 0xbb, 0x29, 0xc9, 0xc6,
+	0x0c, 0x75, 0x94, 0x92, 0x78, 0x88, 0x83, 0x18, 0xbe, 0x78, 0x4a, 0xd8, 0x24, 0xc9, 0x96, 0x0d,
+	0xc0, 0xd5, 0xa5, 0x0e, 0x80, 0xa8, 0x7c, 0xe8, 0xca, 0xb8, 0xdb, 0x0c, 0x59, 0x34, 0xca, 0xc6,
+	0xbb, 0xf6, 0xf6, 0xf6, 0x0b, 0x39, 0x73, 0x23, 0xd7, 0xfb, 0x0a, 0xce, 0x34, 0x41, 0x42, 0x19,
+	0xb6, 0xe9, 0xcd, 0xcd, 0x4d, 0xdb, 0x82, 0xbf, 0xbe, 0x75, 0xe3, 0x1c, 0x1c, 0x58, 0xea, 0xd3,
+	0xef, 0x5b, 0x8d, 0xf5, 0x0b, 0xd6, 0x8d, 0xed, 0x1c, 0xe2, 0xfc, 0x33, 0x20, 0xea, 0xf3, 0xbd,
+	0x60, 0xdf, 0x41, 0xf7, 0x09, 0x4a, 0x8e, 0xd3, 0xb6, 0xec, 0x57, 0x2b, 0xd8, 0x4f, 0xc0, 0xb7,
+	0xf1, 0xb9, 0x8d, 0x4f, 0xed, 0x9c, 0x86, 0x98, 0xa9, 0xc1, 0xe6, 0xcf, 0xb6, 0xf3, 0x4a, 0x90,
+	0x83, 0xa0, 0x5f, 0x44, 0xd9, 0xe4, 0xd6, 0xf5, 0x7d, 0xae, 0x19, 0x4d, 0x69, 0xb8, 0x98, 0xda,
+	0x20, 0xe2, 0x0e, 0xf5, 0x22, 0xe5, 0xf5, 0x6c, 0xb0, 0xb0, 0x1c, 0xfe, 0xe2, 0x23, 0x80, 0xa6,
+	0xd9, 0x32, 0x84, 0xc0, 0x17, 0xa4, 0x49, 0xe8, 0x2e, 0xa9, 0xa6, 0x95, 0xe4, 0x12, 0x81, 0x01,
+	0x10, 0x13, 0x77, 0x41, 0x0b, 0x02, 0xbb, 0xb6, 0xb0, 0xdf, 0x3c, 0x35, 0x1c, 0x5f, 0x6a, 0x56,
+	0x43, 0xc4, 0x8a, 0xb6, 0xa5, 0x7d, 0x61, 0x21, 0xf3, 0x20, 0x0a, 0x89, 0x2c, 0x80, 0x01, 0x15,
+	0x32, 0x46, 0x2d, 0x76, 0x66, 0xe3, 0x20, 0x6d, 0xaa, 0x00, 0x0a, 0xee, 0x80, 0x78, 0xb6, 0xa5,
+	0xbd, 0x87, 0xc0, 0x18, 0x1e, 0x91, 0x49, 0x1c, 0xc5, 0x0a, 0x03, 0x4c, 0x52, 0x17, 0x7e, 0x63,
+	0x0d, 0xdd, 0x30, 0x65, 0x25, 0xb0, 0x53, 0x00, 0x7b, 0x71, 0x18, 0xf3, 0x55, 0x68, 0xf1, 0x55,
+	0x02, 0xef, 0x59, 0xda, 0x69, 0x20, 0x4c, 0x13, 0xec, 0xf8, 0x11, 0x75, 0x24, 0xbc, 0x4a, 0x7e,
+	0xbf, 0x86, 0xb1, 0xba, 0x85, 0x44, 0xa9, 0xef, 0x71, 0x60, 0x69, 0xbf, 0x25, 0xe8, 0xc2, 0x28,
+	0x35, 0x40, 0x4f, 0x71, 0x98, 0x67, 0x57, 0xcd, 0x10, 0x4e, 0xab, 0x74, 0x75, 0xfd, 0x55, 0xb3,
+	0x54, 0xa0, 0xd7, 0x44, 0x36, 0x6d, 0x03, 0x95, 0x7c, 0xbc, 0x94, 0xe3, 0x0a, 0xf4, 0xd5, 0x59,
+	0x09, 0x3d, 0x87, 0x55, 0xcd, 0x94, 0x65, 0x4c, 0xee, 0x34, 0x90, 0xed, 0x4b, 0xf4, 0xf1, 0x3a,
+	0x00, 0xbb, 0x6f, 0xa8, 0xec, 0xc6, 0x07, 0x70, 0xae, 0x56, 0x24, 0xdc, 0x5c, 0xf8, 0x27, 0x26,
+	0x67, 0x18, 0x04, 0x75, 0xcf, 0xec, 0x04, 0xe0, 0x81, 0xd2, 0x56, 0x84, 0x73, 0x06, 0x7d, 0x83,
+	0x0f, 0x4c, 0xaa, 0x47, 0xa6, 0x89, 0x01, 0x58, 0x3b, 0xd2, 0xa3, 0x97, 0x7b, 0x94, 0xda, 0xaf,
+	0xb5, 0xee, 0x80, 0xf7, 0x20, 0xa4, 0x6d, 0xb3, 0x28, 0x4d, 0x84, 0x8c, 0x26, 0x84, 0xd6, 0xc0,
+	0x2a, 0xf0, 0x20, 0x47, 0x83, 0x2d, 0x79, 0x4c, 0xd7, 0x48, 0x00, 0xf1, 0x5a, 0xf0, 0x66, 0x34,
+	0x33, 0x1e, 0x4c, 0xf4, 0xaa, 0x80, 0x9f, 0x8f, 0x35, 0x8b, 0x0f, 0xea, 0x79, 0x30, 0x8f, 0xaa,
+	0x10, 0x1d, 0xd9, 0xa2, 0x62, 0xa8, 0x22, 0xab, 0xcd, 0x0b, 0xb3, 0xce, 0x05, 0x45, 0xa8, 0x3e,
+	0x96, 0x3d, 0x55, 0xc0, 0xf1, 0x26, 0x40, 0x1b, 0x00, 0x55, 0x6c, 0xc2, 0x19, 0xb1, 0xb5, 0xd0,
+	0x85, 0xac, 0x5e, 0xa4, 0xaa, 0xfc, 0x6b, 0x8b, 0xf8, 0x5f, 0xe1, 0x73, 0x05, 0x9f, 0x33, 0x8b,
+	0xa4, 0xf0, 0x9b, 0x9e, 0xd5, 0xcb, 0xbf, 0xdf, 0xdd, 0x50, 0x4f, 0x2c, 0x02, 0x85, 0x9c, 0x70,
+	0x2d, 0x3d, 0xc1, 0xaa, 0x01, 0xe4, 0x06, 0x35, 0x2d, 0xda, 0x6d, 0x83, 0x6c, 0x6f, 0x93, 0x62,
+	0xd2, 0xb4, 0xf3, 0x69, 0x43, 0x25, 0x9d, 0x76, 0xe7, 0x31, 0xd6, 0xbb, 0x77, 0x6b, 0xb1, 0x60,
+	0x3a, 0xc7, 0xb2, 0xd7, 0x60, 0x1d, 0xae, 0xc7, 0x3a, 0x2c, 0xb1, 0x9c, 0x4e, 0x9e, 0xea, 0xf6,
+	0x6a, 0x7a, 0x4e, 0x73, 0x21, 0x02, 0xcb, 0x03, 0x29, 0x4a, 0xaa, 0xb2, 0xda, 0xbd, 0xf1, 0xa4,
+	0x56, 0xab, 0x84, 0xcb, 0x15, 0xbb, 0xba, 0xe2, 0x54, 0x57, 0x9c, 0xea, 0xca, 0x5e, 0x9f, 0x42,
+	0x94, 0x5a, 0x2d, 0x73, 0x60, 0xdb, 0xdb, 0x43, 0x74, 0x2d, 0xa9, 0x42, 0xf2, 0x43, 0x3a, 0xac,
+	0x4f, 0x3b, 0x3f, 0xa7, 0xda, 0x75, 0xc4, 0x9e, 0xd1, 0xf8, 0x06, 0xce, 0x36, 0x10, 0xab, 0x70,
+	0xe6, 0x74, 0x7e, 0x56, 0xcc, 0x0a, 0x67, 0x7b, 0xdf, 0x2f, 0xe6, 0xf3, 0x3a, 0xdb, 0xff, 0x69,
+	0x9d, 0x55, 0x88, 0x1d, 0x7c, 0x3f, 0xb1, 0x57, 0xcf, 0x72, 0xf6, 0x4b, 0x61, 0xbc, 0x87, 0x35,
+	0x2b, 0x82, 0x14, 0x27, 0x8c, 0xd7, 0xb3, 0xb8, 0x35, 0xb2, 0x06, 0xd6, 0x5d, 0x51, 0xcf, 0xdd,
+	0x78, 0x60, 0xb5, 0xa6, 0xce, 0x77, 0xee, 0x8c, 0xd6, 0x9e, 0x63, 0x79, 0x60, 0xa9, 0xa6, 0x3e,
+	0x2a, 0x46, 0x0e, 0x8c, 0x06, 0x72, 0xd4, 0x5f, 0x35, 0xcb, 0xb7, 0x9c, 0xeb, 0x92, 0x5c, 0x9a,
+	0xf9, 0x27, 0x31, 0x16, 0xe1, 0xbb, 0x54, 0x3e, 0xcb, 0x00, 0x53, 0x8c, 0x84, 0xf9, 0x0f, 0x8a,
+	0x91, 0x20, 0xa5, 0xb8, 0xe4, 0x3b, 0x9c, 0x98, 0x64, 0xb4, 0x33, 0x82, 0xef, 0xc1, 0xce, 0xe0,
+	0x51, 0x81, 0xcf, 0x5c, 0xb5, 0x87, 0xea, 0xdc, 0x02, 0xac, 0x91, 0x64, 0xcf, 0x0a, 0x25, 0x4f,
+	0x8d, 0x0b, 0xe5, 0x53, 0x10, 0xe3, 0x31, 0x64, 0x13, 0x15, 0xb3, 0x6d, 0x88, 0xd9, 0x72, 0xa9,
+	0x1a, 0xb3, 0x1b, 0xf7, 0x79, 0xa7, 0xba, 0x96, 0x48, 0x20, 0x88, 0x04, 0x43, 0xa2, 0xc3, 0xb8,
+	0x0b, 0x3b, 0x19, 0xf7, 0x62, 0x3b, 0x18, 0x74, 0x04, 0x07, 0xa2, 0xcb, 0x7c, 0xc8, 0x45, 0x80,
+	0x89, 0x1a, 0xdb, 0x79, 0xee, 0x0b, 0xd2, 0xf7, 0x50, 0x3a, 0x07, 0xe9, 0x67, 0xe6, 0x63, 0xd0,
+	0x23, 0xfa, 0x9a, 0x0e, 0x36, 0x3d, 0x5e, 0x9e, 0x88, 0xba, 0x1e, 0x92, 0x00, 0x84, 0xfe, 0x4a,
+	0x4b, 0x08, 0xf1, 0x58, 0x72, 0x4b, 0x28, 0x25, 0x6d, 0x20, 0xe0, 0x86, 0x8c, 0x67, 0xba, 0xf6,
+	0x2e, 0xe0, 0x69, 0x06, 0xb1, 0xa8, 0x2c, 0x1b, 0x34, 0x23, 0xd7, 0x66, 0x1e, 0x9b, 0xa1, 0x1e,
+	0x14, 0xf1, 0x7a, 0x25, 0xb5, 0x09, 0xad, 0x0b, 0x2e, 0x90, 0xa3, 0xed, 0x6d, 0xb0, 0x38, 0x04,
+	0xdb, 0xb6, 0x0d, 0xb0, 0x21, 0xa3, 0xdc, 0xe1, 0x12, 0x2a, 0x0e, 0x32, 0x1f, 0x07, 0x19, 0xdb,
+	0x1d, 0x40, 0x46, 0xba, 0x23, 0xaa, 0xcc, 0xa9, 0xef, 0x23, 0x28, 0xbd, 0x90, 0xc2, 0xa9, 0xed,
+	0x14, 0x39, 0x30, 0xde, 0xb7, 0x9d, 0x86, 0x54, 0x23, 0x95, 0x95, 0xe9, 0x8d, 0x5c, 0xaa, 0xa4,
+	0x1c, 0x3f, 0xcd, 0xb0, 0x3a, 0xaf, 0x74, 0xee, 0xd0, 0xe7, 0xa4, 0x50, 0x3c, 0xe5, 0x6d, 0x4e,
+	0x16, 0x64, 0xd0, 0xbb, 0xf4, 0x2e, 0x64, 0x2d, 0xc4, 0x54, 0xb1, 0xd0, 0x6d, 0x09, 0x98, 0x9e,
+	0xc8, 0xa5, 0x5d, 0xcf, 0x8d, 0x66, 0x50, 0x5a, 0x8b, 0x0e, 0x48, 0x3e, 0x6e, 0x41, 0x07, 0x23,
+	0x9f, 0x44, 0x13, 0x83, 0xa7, 0x8b, 0xa3, 0xa2, 0xa1, 0x96, 0x43, 0xec, 0x09, 0xae, 0xa8, 0xea,
+	0x9c, 0xe7, 0x81, 0x0f, 0x16, 0xd1, 0x48, 0xcf, 0xf2, 0x89, 0x31, 0x0b, 0x46, 0x63, 0xd1, 0x59,
+	0xe3, 0x59, 0x14, 0xb8, 0x72, 0x88, 0xb8, 0xf8, 0x24, 0x11, 0x69, 0x7a, 0x55, 0x4c, 0x48, 0x44,
+	0x2a, 0x12, 0x9f, 0x9a, 0x01, 0xdc, 0x93, 0x18, 0x1a, 0x8e, 0x05, 0x68, 0xd5, 0xf1, 0x41, 0x5a,
+	0x68, 0x31, 0xe6, 0xb2, 0xcc, 0x51, 0x77, 0x30, 0xa2, 0x64, 0x85, 0x6c, 0x99, 0x9e, 0x01, 0x5d,
+	0xff, 0x1a, 0xd4, 0xc5, 0x53, 0x76, 0x1e, 0x65, 0x7a, 0x35, 0x35, 0x2f, 0xf2, 0xd4, 0x2c, 0x60,
+	0xbe, 0xae, 0x87, 0x59, 0x56, 0x61, 0xae, 0xd6, 0xc3, 0xcc, 0xab, 0x30, 0x67, 0xeb, 0x61, 0xc6,
+	0x15, 0x18, 0x11, 0x94, 0xfc, 0xab, 0xee, 0x9e, 0xf1, 0xe7, 0x9f, 0xba, 0x7f, 0x06, 0xbf, 0xa5,
+	0x89, 0xa0, 0x0c, 0x04, 0xcc, 0x24, 0x8b, 0x63, 0x92, 0x4e, 0xdc, 0x30, 0xac, 0x1b, 0x87, 0x54,
+	0xb4, 0x52, 0x91, 0x0f, 0x2a, 0x52, 0x13, 0x4a, 0x45, 0xfe, 0x59, 0x27, 0x77, 0x66, 0xb6, 0xc8,
+	0xdd, 0x39, 0xf9, 0xc2, 0x3d, 0xba, 0x49, 0x71, 0x30, 0x81, 0x7b, 0x8a, 0x2b, 0x0c, 0xbd, 0xaa,
+	0x34, 0xc4, 0x3c, 0x4d, 0x33, 0xaa, 0x76, 0x78, 0x1e, 0x13, 0x8a, 0x14, 0xff, 0x4c, 0x8a, 0x87,
+	0x1e, 0x0a, 0x52, 0x15, 0xc1, 0xe2, 0x1b, 0x30, 0xf3, 0xad, 0x0b, 0xec, 0x7d, 0x83, 0x08, 0x21,
+	0x03, 0xc4, 0x92, 0xfa, 0x5f, 0xcd, 0x6f, 0xd2, 0x73, 0xf4, 0x65, 0xb7, 0x2d, 0xb4, 0xb1, 0xec,
+	0xc1, 0x29, 0x1b, 0x55, 0x44, 0x59, 0x19, 0x82, 0xa4, 0x10, 0x5a, 0x2c, 0x14, 0xcb, 0xa4, 0xfb,
+	0x46, 0x51, 0x32, 0x00, 0x83, 0x72, 0xd6, 0xd2, 0x03, 0xf3, 0x9b, 0xf1, 0xd2, 0x11, 0xc5, 0xa1,
+	0x7d, 0xd4, 0x06, 0x36, 0x3c, 0xe0, 0x36, 0x88, 0xa6, 0x0c, 0x43, 0xc8, 0x3a, 0x72, 0x8a, 0x8f,
+	0x05, 0xf5, 0xaf, 0xcd, 0x40, 0xf1, 0xb1, 0x90, 0x7c, 0x2c, 0x80, 0x8f, 0x2b, 0x43, 0x5e, 0x3a,
+	0x3d, 0xb7, 0x4f, 0xce, 0x54, 0x7d, 0x47, 0x54, 0x5f, 0x9c, 0x52, 0x7d, 0xb9, 0x93, 0x5e, 0x99,
+	0x0b, 0x63, 0x67, 0xbf, 0xb3, 0x86, 0x58, 0x1e, 0x88, 0xc5, 0x11, 0xc9, 0xcc, 0x03, 0x38, 0x7d,
+	0xab, 0x36, 0x84, 0x0c, 0xb5, 0x32, 0xe1, 0x60, 0x29, 0x5d, 0xee, 0x2b, 0x42, 0xe6, 0x03, 0x34,
+	0x43, 0x4c, 0x0a, 0xe4, 0x9e, 0x97, 0xa1, 0x7c, 0x20, 0x9e, 0xed, 0x22, 0xac, 0x8b, 0x66, 0x56,
+	0xdc, 0xb7, 0xc1, 0xaf, 0xbb, 0xd4, 0x1d, 0x71, 0x15, 0x84, 0x93, 0x10, 0xda, 0x2b, 0xf3, 0xfe,
+	0x55, 0xb9, 0x60, 0x3f, 0x5a, 0x58, 0xaf, 0xcb, 0x1c, 0x7e, 0x80, 0x11, 0x11, 0x72, 0xad, 0x6a,
+	0x2a, 0x3b, 0xff, 0x98, 0x0d, 0xfc, 0xa0, 0x09, 0xa0, 0x56, 0x74, 0x1d, 0x15, 0x22, 0x9e, 0x0d,
+	0xd3, 0x36, 0xb6, 0xed, 0x4d, 0xe2, 0x3c, 0x2f, 0xcd, 0x7f, 0x6a, 0x49, 0x62, 0x2e, 0x0e, 0x21,
+	0x11, 0x49, 0x36, 0x5d, 0xc5, 0xa6, 0xea, 0xaf, 0x68, 0xcd, 0x5c, 0x08, 0xe9, 0x9b, 0x00, 0x5b,
+	0xdc, 0xc7, 0x8e, 0xe8, 0xaa, 0x79, 0xe1, 0xb2, 0xad, 0x96, 0x07, 0x74, 0xd5, 0xd8, 0x70, 0xd9,
+	0x51, 0xcb, 0x50, 0x2c, 0x83, 0x18, 0x84, 0xaa, 0x9b, 0xe8, 0x9b, 0x7a, 0x29, 0x21, 0x2a, 0x6e,
+	0x10, 0x50, 0x15, 0x51, 0x28, 0x8e, 0x09, 0x25, 0x39, 0xe2, 0xc8, 0x1a, 0x7e, 0xe3, 0xaa, 0xfd,
+	0xe4, 0xaa, 0xb3, 0x7e, 0x15, 0x4b, 0x7a, 0x4e, 0x75, 0xbe, 0x5b, 0xec, 0x01, 0x7a, 0x1c, 0x51,
+	0x7d, 0xb4, 0x5b, 0x90, 0x85, 0x89, 0x01, 0xd5, 0x07, 0xbb, 0x05, 0x25, 0x55, 0x7f, 0x04, 0x22,
+	0x39, 0xdf, 0xaf, 0xd8, 0x2d, 0x28, 0x8b, 0xaa, 0x8a, 0xee, 0xd1, 0x82, 0xaa, 0xf0, 0x0e, 0x9b,
+	0xed, 0xd2, 0x3d, 0xd4, 0xaa, 0xa8, 0x22, 0xd7, 0xa2, 0x09, 0xe7, 0x95, 0x68, 0x4e, 0x15, 0xcd,
+	0xdd, 0x84, 0xe6, 0xae, 0xa2, 0xc9, 0xdd, 0xd0, 0xbb, 0x89, 0xe2, 0xda, 0xbf, 0xda, 0xb5, 0x1f,
+	0x31, 0xbe, 0xbb, 0x89, 0x83, 0x5d, 0xfb, 0x29, 0xc6, 0xbf, 0x43, 0xde, 0x5f, 0x4b, 0x0e, 0xfe,
+	0xc2, 0xa6, 0x7b, 0x7f, 0x6d, 0xd3, 0x83, 0xbf, 0xa6, 0x64, 0xfb, 0xa7, 0x94, 0xac, 0xfe, 0x36,
+	0x25, 0xbc, 0x64, 0x5a, 0x49, 0x78, 0xe8, 0xc7, 0x10, 0x12, 0x8c, 0xc2, 0x45, 0x17, 0xe2, 0x3d,
+	0x4f, 0x9a, 0x9d, 0x8b, 0xa2, 0x15, 0x7b, 0x77, 0x28, 0xee, 0x20, 0x23, 0xc2, 0xb7, 0x4a, 0xca,
+	0x8b, 0xf1, 0x67, 0xf6, 0x07, 0x4e, 0x5c, 0x2b, 0x47, 0xfd, 0xe3, 0x82, 0x0f, 0x2d, 0xfe, 0xc7,
+	0x87, 0x54, 0xbd, 0x2c, 0x4a, 0xf8, 0xec, 0x62, 0x61, 0xc1, 0xf7, 0x97, 0xac, 0xd2, 0xe3, 0x87,
+	0xfe, 0x05, 0x9f, 0xe9, 0xc6, 0x3d, 0xe4, 0x55, 0x24, 0xd1, 0x4c, 0x33, 0x37, 0x9b, 0xa6, 0x2f,
+	0xa8, 0x03, 0xed, 0xc9, 0x3d, 0xee, 0x4b, 0x11, 0xb3, 0x83, 0xbb, 0x53, 0x89, 0xff, 0x50, 0x6d,
+	0xb0, 0x67, 0x92, 0x02, 0x42, 0x51, 0xc4, 0xe8, 0x20, 0x14, 0x95, 0xfc, 0x56, 0x40, 0x07, 0xcb,
+	0x8c, 0x5d, 0xc6, 0x5f, 0x32, 0xae, 0xcf, 0x8a, 0x57, 0x4a, 0x30, 0x0a, 0xa2, 0x51, 0x73, 0xc8,
+	0xe3, 0xc9, 0xc9, 0xd8, 0xe5, 0x27, 0xb1, 0xcf, 0x74, 0x7d, 0x46, 0xb6, 0x09, 0x54, 0xa4, 0x06,
+	0xb4, 0x17, 0xbf, 0x1e, 0x5a, 0x44, 0x4c, 0xf4, 0x7a, 0x04, 0x52, 0x73, 0x65, 0xba, 0xf6, 0xca,
+	0x69, 0x1e, 0x73, 0x7f, 0x95, 0x72, 0x65, 0xb7, 0x6d, 0xd9, 0x9b, 0x99, 0x95, 0x39, 0x7d, 0xd6,
+	0xeb, 0xbd, 0x32, 0xe4, 0x42, 0x95, 0xd2, 0xf4, 0x36, 0x65, 0x91, 0xaf, 0x7b, 0x13, 0xdf, 0x8a,
+	0xe0, 0x78, 0xc0, 0x17, 0xa4, 0x5e, 0xe2, 0x84, 0x45, 0xba, 0x76, 0xf1, 0xe9, 0xcb, 0xa5, 0x66,
+	0xa1, 0x6e, 0x4d, 0x01, 0x42, 0xe4, 0x25, 0x99, 0x82, 0x41, 0x4c, 0x59, 0xa4, 0x20, 0x2e, 0x2a,
+	0xc0, 0x34, 0x8b, 0xb6, 0xa9, 0x5d, 0xeb, 0x38, 0xa6, 0xb7, 0x02, 0x48, 0x5c, 0x83, 0x87, 0x91,
+	0xca, 0xaa, 0x52, 0xdf, 0xf0, 0xa0, 0xb8, 0xd0, 0x3e, 0xbe, 0xbd, 0x86, 0xfd, 0xd4, 0x26, 0x35,
+	0x5c, 0x3f, 0x8e, 0x98, 0x5e, 0x79, 0x73, 0x15, 0xc6, 0xa3, 0x4b, 0x77, 0xa4, 0x59, 0xda, 0x49,
+	0x3c, 0x49, 0x42, 0x96, 0xb1, 0x17, 0x65, 0x71, 0x97, 0x0b, 0xa5, 0x7d, 0x39, 0xfb, 0x74, 0xb5,
+	0x9e, 0x9c, 0xb8, 0xca, 0x7b, 0xa3, 0xbb, 0xd6, 0x9d, 0x6d, 0xdd, 0x39, 0x45, 0xca, 0xd1, 0x34,
+	0x53, 0xbf, 0xb3, 0xcd, 0x3b, 0x67, 0x07, 0x39, 0x6b, 0xb9, 0xaa, 0xbb, 0x91, 0x32, 0x2e, 0xd4,
+	0xa8, 0x77, 0x60, 0x2c, 0xe8, 0xa2, 0x99, 0x4e, 0x07, 0x29, 0x1e, 0x26, 0x14, 0x6c, 0x07, 0x95,
+	0xdb, 0xaf, 0x82, 0x33, 0xe8, 0x0a, 0x46, 0x1c, 0xda, 0x82, 0x23, 0xa2, 0x99, 0x0b, 0x53, 0x7b,
+	0xa9, 0x15, 0x8a, 0x7b, 0xac, 0x5c, 0xed, 0xfd, 0xa7, 0x37, 0xa7, 0xda, 0x3a, 0xfd, 0xa2, 0x49,
+	0x9b, 0xe5, 0x81, 0xe3, 0x38, 0xe7, 0x4b, 0xe1, 0x49, 0xfe, 0x90, 0xe7, 0x1e, 0x2d, 0x98, 0x7e,
+	0xee, 0x38, 0x84, 0x0e, 0x8e, 0xff, 0xcf, 0x75, 0x20, 0x52, 0xa0, 0xb0, 0x03, 0x4f, 0x69, 0x01,
+	0x1a, 0x6e, 0x24, 0x8e, 0xb7, 0xe5, 0xca, 0xd5, 0x91, 0xb0, 0x47, 0x29, 0x64, 0x0a, 0x58, 0x86,
+	0x9e, 0x33, 0x04, 0x97, 0xc5, 0x8d, 0xba, 0xc5, 0x3e, 0xd0, 0xa9, 0x56, 0x99, 0xea, 0xda, 0x07,
+	0xe2, 0xba, 0x43, 0xb5, 0xef, 0x33, 0x75, 0x3d, 0x5b, 0x2d, 0x76, 0xec, 0x5f, 0xa0, 0xd8, 0xa1,
+	0xb8, 0x61, 0xce, 0x76, 0x49, 0x6d, 0xf6, 0x27, 0xd5, 0xa1, 0x62, 0x10, 0x93, 0xfd, 0x6e, 0x37,
+	0x30, 0x94, 0xa7, 0x08, 0x39, 0x1e, 0x24, 0x7f, 0xc4, 0xa4, 0xb5, 0x20, 0x20, 0x23, 0xae, 0xca,
+	0x6c, 0xc8, 0xac, 0xf3, 0xb7, 0x33, 0xbb, 0x6f, 0x3c, 0xc9, 0x29, 0xd4, 0x10, 0x92, 0xd7, 0x67,
+	0x18, 0xfc, 0xdb, 0xb8, 0x7a, 0x95, 0x5f, 0x91, 0xe0, 0xc5, 0xd4, 0x23, 0x62, 0xb9, 0x02, 0x5f,
+	0x50, 0xcf, 0x40, 0x3e, 0x6d, 0xe7, 0x55, 0xaf, 0xb7, 0x49, 0x99, 0xd5, 0x58, 0x2d, 0x79, 0x2d,
+	0x62, 0x49, 0x3d, 0x56, 0xac, 0x31, 0xa0, 0xe3, 0x8a, 0x01, 0x29, 0x37, 0xea, 0xac, 0x33, 0x23,
+	0x29, 0xf7, 0x63, 0x21, 0x41, 0x04, 0x6c, 0x30, 0xe5, 0xfa, 0xa2, 0x6b, 0x3b, 0xce, 0x66, 0xb9,
+	0x75, 0x10, 0x5c, 0x88, 0x27, 0xc1, 0xb0, 0x8c, 0x5f, 0xc8, 0xdb, 0xfd, 0xf2, 0x1c, 0x84, 0xc8,
+	0x35, 0x89, 0xbf, 0x57, 0xcc, 0xe3, 0x0d, 0x62, 0x56, 0x5f, 0x7d, 0xa8, 0x2b, 0xa9, 0x35, 0xf7,
+	0x15, 0x62, 0x7e, 0x4e, 0x31, 0x57, 0x53, 0x2f, 0xbf, 0xb3, 0x10, 0x93, 0x63, 0x9c, 0x3c, 0x83,
+	0xc9, 0xfc, 0xde, 0x02, 0x33, 0x34, 0x8c, 0x9f, 0xef, 0x84, 0xe7, 0xd6, 0x58, 0x91, 0x76, 0x2b,
+	0xdd, 0xd3, 0x7c, 0x27, 0x9f, 0x0d, 0xf2, 0xf6, 0x6c, 0x02, 0xa9, 0x74, 0xf5, 0x36, 0x69, 0xaf,
+	0x5f, 0xbe, 0x17, 0x59, 0x02, 0xe0, 0xb2, 0x3b, 0xee, 0x2c, 0x41, 0x5b, 0xf9, 0x9c, 0x50, 0xfb,
+	0xa2, 0x3b, 0xef, 0x2c, 0x44, 0x33, 0x04, 0xf3, 0xf2, 0xce, 0x1a, 0x29, 0x09, 0xdf, 0xc4, 0x8b,
+	0xce, 0xd5, 0xab, 0xed, 0xa0, 0xdb, 0xc5, 0x66, 0x0f, 0x4c, 0xb9, 0x0a, 0x50, 0xae, 0x3c, 0x34,
+	0xb0, 0x2e, 0xa9, 0x25, 0x38, 0x59, 0x4d, 0xb4, 0x55, 0x54, 0x43, 0x41, 0xae, 0x3f, 0xbc, 0x3f,
+	0xcb, 0xb2, 0x04, 0x86, 0x53, 0x96, 0xe2, 0xbf, 0x0d, 0xb4, 0x5a, 0x64, 0x38, 0xe5, 0xe2, 0x35,
+	0x15, 0x49, 0xd4, 0x7f, 0xb1, 0x70, 0x26, 0x2e, 0x45, 0xb9, 0xbc, 0x5c, 0x1a, 0x2c, 0x89, 0x0b,
+	0x2b, 0xd9, 0x18, 0x8a, 0x1b, 0x36, 0x0c, 0x16, 0x52, 0x8b, 0x51, 0x48, 0xcd, 0xd5, 0xf7, 0x7a,
+	0x78, 0x3b, 0xa2, 0xb4, 0x9c, 0x8d, 0x29, 0xc0, 0xf4, 0xda, 0xaf, 0xe1, 0xdb, 0xd4, 0x5a, 0xe2,
+	0x85, 0xb5, 0x30, 0x08, 0x88, 0xb8, 0x54, 0x1b, 0x03, 0x03, 0x47, 0xad, 0x96, 0x66, 0x6e, 0x78,
+	0xcf, 0x28, 0xe0, 0xcd, 0x24, 0x3f, 0xc6, 0x20, 0x0a, 0x32, 0x0a, 0x23, 0x53, 0x7b, 0x7b, 0x71,
+	0xaa, 0xc9, 0xca, 0x5f, 0xea, 0x6a, 0xaf, 0xac, 0x1b, 0xe4, 0x7f, 0x9b, 0xe4, 0x03, 0xa8, 0x12,
+	0xc1, 0x78, 0xeb, 0x6f, 0xc1, 0x55, 0x0d, 0x86, 0x61, 0x55, 0xea, 0x05, 0x9a, 0x87, 0xc2, 0x0c,
+	0x73, 0x87, 0x12, 0x67, 0x6f, 0xb7, 0xdb, 0x35, 0x30, 0xbb, 0x02, 0x86, 0xf5, 0x00, 0xfe, 0xfb,
+	0xc8, 0xe3, 0x7c, 0x22, 0x18, 0x5d, 0x97, 0x47, 0x4a, 0xeb, 0x97, 0x06, 0x62, 0x18, 0xf5, 0xc4,
+	0x50, 0x0a, 0xb4, 0xff, 0xcf, 0x08, 0x74, 0xb0, 0x51, 0x1e, 0x59, 0x1b, 0x55, 0x17, 0x9d, 0xc7,
+	0x24, 0xf6, 0x80, 0xc0, 0x2a, 0x8d, 0xbd, 0x7f, 0x49, 0x27, 0xdd, 0xa7, 0xcf, 0x98, 0xfe, 0x98,
+	0x42, 0x44, 0x3c, 0xdd, 0x15, 0x64, 0xff, 0x83, 0x53, 0x96, 0x49, 0xe8, 0x27, 0x44, 0xd9, 0xde,
+	0x96, 0xf0, 0xe0, 0x96, 0x49, 0x1c, 0xa5, 0xec, 0x12, 0xce, 0xae, 0x89, 0x7d, 0xf4, 0xa7, 0x21,
+	0xf8, 0x60, 0x08, 0x4e, 0x08, 0xf1, 0xb0, 0x07, 0x32, 0x4b, 0x8c, 0xfd, 0x2a, 0xf6, 0xfe, 0x1a,
+	0x45, 0xd8, 0x6b, 0xb4, 0x70, 0xf0, 0x58, 0x0b, 0x4f, 0x6a, 0x53, 0xda, 0xed, 0x2f, 0xaf, 0x77,
+	0xed, 0xa3, 0x9f, 0xb4, 0xb4, 0x37, 0xff, 0x96, 0xa5, 0x99, 0x9a, 0xa3, 0xad, 0x9c, 0xcd, 0x43,
+	0xe3, 0x7f, 0x1a, 0xe9, 0x44, 0x7b, 0x03, 0x28, 0x00, 0x00,
+};
+
+const char WEB_HTML_ETAG[] = "\"ccdd5b0fd5a00077\"";
+const uint8_t WEB_HTML[] PROGMEM = {
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x54, 0x51, 0x6f, 0xd3, 0x30,
+	0x10, 0x7e, 0xdf, 0xaf, 0x30, 0x95, 0x90, 0x5f, 0x58, 0xdb, 0x95, 0xb6, 0x8c, 0xae, 0x09, 0x52,
+	0x19, 0x12, 0x7b, 0x61, 0x15, 0x9a, 0x04, 0x7b, 0x9a, 0x1c, 0xfb, 0x92, 0x98, 0x39, 0x76, 0x64,
+	0x3b, 0xdd, 0xfa, 0xef, 0x39, 0x3b, 0x4d, 0x49, 0xdb, 0x0d, 0xc1, 0x4b, 0x2c, 0xdf, 0x9d, 0xbf,
+	0xef, 0xbb, 0x73, 0x3e, 0x2f, 0xdf, 0x5c, 0xdf, 0x7e, 0xbe, 0xbb, 0x5f, 0x7f, 0x21, 0xa5, 0xaf,
+	0x54, 0x7a, 0xb6, 0xec, 0x16, 0x60, 0x02, 0x17, 0x25, 0xf5, 0x23, 0xb1, 0xa0, 0x12, 0x2a, 0xb9,
+	0xd1, 0x94, 0x94, 0x16, 0xf2, 0x84, 0x0a, 0xe6, 0xd9, 0xe2, 0x2a, 0x63, 0x0e, 0xe6, 0xd3, 0x77,
+	0x09, 0xc5, 0xba, 0x0a, 0x3c, 0x23, 0xbc, 0x64, 0xd6, 0x81, 0x4f, 0x68, 0xe3, 0xf3, 0xf3, 0xcb,
+	0x10, 0xf6, 0xd2, 0x2b, 0x48, 0xd7, 0x56, 0x72, 0xb8, 0x63, 0xc5, 0x72, 0xd4, 0xee, 0xfb, 0xb0,
+	0xce, 0x6f, 0x15, 0xb8, 0x12, 0xc0, 0x77, 0xe0, 0x6d, 0x64, 0xc8, 0x9d, 0xfb, 0xb4, 0x49, 0xd8,
+	0x6c, 0x3a, 0xe3, 0xd9, 0xec, 0xfd, 0xc7, 0xd9, 0x64, 0x02, 0x59, 0xce, 0x03, 0xa8, 0xe3, 0x56,
+	0xd6, 0x9e, 0x38, 0xcb, 0x13, 0x8a, 0xa2, 0x72, 0x59, 0x0c, 0x7f, 0x39, 0x9a, 0x2e, 0x47, 0x6d,
+	0xe2, 0xa8, 0x82, 0xd5, 0x35, 0xa6, 0x11, 0xea, 0x82, 0xcf, 0x67, 0xf3, 0x71, 0x96, 0x65, 0x17,
+	0xf9, 0xe5, 0xfc, 0x03, 0xc0, 0xc1, 0x89, 0xd1, 0xae, 0xdf, 0xcc, 0x88, 0x2d, 0x2e, 0x42, 0x6e,
+	0x08, 0x57, 0xcc, 0xb9, 0x84, 0x86, 0x04, 0xd8, 0x87, 0x8c, 0xf1, 0x47, 0xfa, 0x62, 0x26, 0x67,
+	0x3c, 0x62, 0x61, 0x26, 0x00, 0xb5, 0x4b, 0xaf, 0x0c, 0x25, 0x7a, 0xd0, 0xfe, 0x25, 0x84, 0x2e,
+	0xd5, 0x42, 0xe0, 0xb8, 0x58, 0xa6, 0x80, 0xc4, 0x01, 0x24, 0xf4, 0x49, 0x0a, 0x5f, 0x2e, 0x2e,
+	0xc6, 0xe3, 0xb7, 0x57, 0xa4, 0x04, 0x59, 0x94, 0x3e, 0x6e, 0x28, 0xc9, 0x8c, 0x45, 0xde, 0x84,
+	0x8e, 0x29, 0xe1, 0xa0, 0x94, 0xab, 0x19, 0x97, 0xba, 0x08, 0xfb, 0x00, 0x61, 0xc3, 0x47, 0x74,
+	0x0c, 0x15, 0xe8, 0x06, 0x99, 0x2d, 0x25, 0xd6, 0x3c, 0x61, 0xa5, 0x4e, 0xe8, 0xa4, 0x13, 0x21,
+	0x45, 0x42, 0x57, 0x77, 0x7f, 0xa4, 0x47, 0xf6, 0x53, 0x08, 0x6e, 0x2a, 0x44, 0xc1, 0xeb, 0xe1,
+	0x46, 0xb5, 0x08, 0x53, 0x3c, 0x93, 0xd9, 0xf4, 0x1a, 0x36, 0x78, 0xaf, 0xe4, 0x66, 0xbd, 0xc0,
+	0x8b, 0x0d, 0xc3, 0x1b, 0xb5, 0x27, 0xbb, 0xe3, 0xbb, 0xf2, 0xc1, 0x74, 0x90, 0x2e, 0xa5, 0xae,
+	0x1b, 0x1f, 0x18, 0x07, 0xb2, 0x7e, 0x60, 0x42, 0xd8, 0xc1, 0xae, 0xcd, 0x41, 0xaf, 0x4d, 0x0f,
+	0xcf, 0xfe, 0x9c, 0x29, 0x59, 0xe8, 0x05, 0x47, 0x46, 0xc0, 0x22, 0xbf, 0xad, 0xb1, 0x26, 0x24,
+	0x06, 0x64, 0xc3, 0x54, 0x83, 0x1b, 0x44, 0x3b, 0xa4, 0x8b, 0x8d, 0xac, 0xbf, 0xd1, 0x6e, 0x70,
+	0x42, 0xba, 0x5a, 0xb1, 0xed, 0x42, 0x1b, 0xdd, 0x4e, 0xf5, 0x2f, 0xad, 0xe0, 0x30, 0xd6, 0x4c,
+	0x83, 0xea, 0x5a, 0xe8, 0xeb, 0x9e, 0x1c, 0xe8, 0xae, 0x43, 0xd9, 0x7f, 0xa9, 0xd6, 0x4d, 0x95,
+	0x85, 0x5d, 0x25, 0x11, 0x6c, 0xbc, 0xd7, 0x3f, 0x3e, 0x69, 0x20, 0xfd, 0x97, 0x69, 0xaf, 0x4c,
+	0xa3, 0x85, 0x6b, 0x75, 0x1e, 0xb6, 0xfe, 0xf3, 0x9e, 0x1e, 0x45, 0x7e, 0x7c, 0xdd, 0x47, 0x46,
+	0xdd, 0xad, 0x76, 0x37, 0xfe, 0x7d, 0xd5, 0xfb, 0x59, 0xf7, 0x3d, 0x1f, 0xfd, 0xaa, 0xe8, 0x82,
+	0xe8, 0x34, 0x14, 0xd0, 0xe5, 0xa2, 0x75, 0x69, 0x7a, 0x6b, 0x65, 0x21, 0x35, 0x53, 0x44, 0x56,
+	0xac, 0x00, 0x74, 0x10, 0x96, 0x44, 0x7d, 0x67, 0x4b, 0xce, 0xf4, 0x86, 0xb9, 0x48, 0xe2, 0x4c,
+	0x63, 0xf1, 0x97, 0xde, 0x3b, 0x45, 0x0a, 0x01, 0xfa, 0x21, 0x0e, 0x33, 0xb0, 0xb7, 0x95, 0x3d,
+	0x51, 0xe8, 0xd4, 0x95, 0x79, 0x3e, 0x72, 0x87, 0xac, 0x8a, 0xd3, 0x60, 0x05, 0x2e, 0x06, 0xaf,
+	0xad, 0xa9, 0x5b, 0x0d, 0x68, 0x0e, 0x0b, 0xc3, 0xe1, 0xf0, 0xc8, 0x81, 0x07, 0x2d, 0x1e, 0xfe,
+	0x99, 0x81, 0x51, 0x38, 0x1f, 0x70, 0x5e, 0xeb, 0xbc, 0x7f, 0x6c, 0x3f, 0xc2, 0x57, 0x2d, 0x9e,
+	0x1b, 0xe3, 0x5f, 0x7e, 0x23, 0x76, 0x99, 0x68, 0xf0, 0xc8, 0xab, 0x4c, 0x81, 0x2f, 0x21, 0x3d,
+	0xd5, 0xb9, 0x7b, 0x79, 0x46, 0xed, 0xfb, 0xfb, 0x1b, 0x79, 0x80, 0x2d, 0x12, 0x97, 0x05, 0x00,
+	0x00,
+};
+